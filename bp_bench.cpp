@@ -0,0 +1,83 @@
+#include <strie/bp.hpp>
+#include <strie/dfuds.hpp>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+// Space and findclose time of BpSupport per pioneer bitvector, one position
+// at a time and in a batch, on the DFUDS of a trie of the given keys.
+//
+// usage: bp_bench [key_file|-]
+
+namespace {
+
+class DfudsBits : public strie::DfudsTrie {
+ public:
+  template<typename It>
+  DfudsBits(It begin, It end) : strie::DfudsTrie(begin, end) {}
+  const sdsl::bit_vector& bits() const { return bv_; }
+};
+
+template<typename BP>
+void bench(const char* name, sdsl::bit_vector& bv, const std::vector<size_t>& queries) {
+  sdsl::rank_support_v<1, 1> rank(&bv);
+  BP bp(&bv, &rank);
+  size_t sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (auto i : queries)
+    sum += bp.findclose(i);
+  auto sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::vector<size_t> closes(queries.size());
+  start = std::chrono::steady_clock::now();
+  bp.findclose(queries.data(), queries.size(), closes.data());
+  auto batch_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  for (auto c : closes)
+    sum -= c;
+  std::cout << name << '\t' << bp.num_levels() << '\t'
+            << 8.0 * bp.size_in_bytes() / bv.size() << '\t'
+            << sec * 1e9 / queries.size() << '\t' << batch_sec * 1e9 / queries.size() << '\t'
+            << sum << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<std::string> keys;
+  if (argc > 1 and std::string(argv[1]) != "-") {
+    std::ifstream ifs(argv[1]);
+    for (std::string s; std::getline(ifs, s); )
+      keys.push_back(s);
+  } else {
+    std::mt19937 rng(0);
+    for (int i = 0; i < 1000000; i++) {
+      std::string s(4 + rng() % 12, 'a');
+      for (auto& c : s) c = 'a' + rng() % 26;
+      keys.push_back(s);
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+  auto bv = DfudsBits(keys.begin(), keys.end()).bits();
+  std::vector<size_t> opens;
+  for (size_t i = 0; i < bv.size(); i++)
+    if (bv[i])
+      opens.push_back(i);
+  std::mt19937 rng(0);
+  std::vector<size_t> queries(1000000);
+  for (auto& q : queries)
+    q = opens[rng() % opens.size()];
+
+  std::cout << "parentheses: " << bv.size() << std::endl;
+  std::cout << "pioneers\tlevels\tbits/paren\tns/findclose\tns/batch\t(diff)" << std::endl;
+  bench<strie::PlainBpSupport>("plain", bv, queries);
+  bench<strie::RrrBpSupport<15>>("rrr15", bv, queries);
+  bench<strie::RrrBpSupport<63>>("rrr63", bv, queries);
+  bench<strie::RrrBpSupport<127>>("rrr127", bv, queries);
+  bench<strie::SparseBpSupport>("sd", bv, queries);
+}
@@ -2,11 +2,13 @@
 
 #include <iostream>
 #include <vector>
+#include <random>
+#include <algorithm>
 
 #include <sdsl/bit_vectors.hpp>
 
-int main() {
-  std::string bv = "11110110001001110000";
+template<typename BP = strie::BpSupport<>>
+unsigned test(const std::string& bv) {
   std::stack<int> os;
   int n = bv.size();
   std::vector<int> p(n);
@@ -22,7 +24,7 @@ int main() {
   sdsl::bit_vector v(n);
   for (int i = 0; i < n; i++) v[i] = bv[i] == '1';
   sdsl::rank_support_v<> rank(&v);
-  strie::BpSupport<> bp(&v, &rank);
+  BP bp(&v, &rank);
 //  bp.print_for_debug();
   std::vector<int> fc(n);
   for (int i = 0; i < n; i++) {
@@ -46,5 +48,70 @@ int main() {
       assert(false);
     }
   }
+
+  // The batch findclose, over opening positions in random order
+  std::vector<size_t> opens, closes;
+  for (int i = 0; i < n; i++)
+    if (bv[i] == '1')
+      opens.push_back(i);
+  std::shuffle(opens.begin(), opens.end(), std::mt19937(n));
+  closes.resize(opens.size());
+  bp.findclose(opens.data(), opens.size(), closes.data());
+  for (size_t k = 0; k < opens.size(); k++) {
+    if (closes[k] != p[opens[k]]) {
+      std::cout << "batch " << opens[k] << ' ' << closes[k] << " != " << p[opens[k]] << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  return bp.num_levels();
+}
+
+std::string random_tree(std::mt19937& rng, int m) {
+  std::string bv = "1";
+  int open = 0;
+  while (m > 0 or open > 0) {
+    if (m > 0 and (open == 0 or rng() % 2)) {
+      bv += '1';
+      open++;
+      m--;
+    } else {
+      bv += '0';
+      open--;
+    }
+  }
+  bv += '0';
+  return bv;
+}
+
+int main() {
+  test("11110110001001110000");
+
+  // Random trees spanning many blocks, to go through the pioneer levels.
+  std::mt19937 rng(0);
+  for (int t = 0; t < 100; t++)
+    test(random_tree(rng, 1 + rng() % 5000));
+
+  // Pioneer bitvectors
+  for (int t = 0; t < 10; t++) {
+    auto bv = random_tree(rng, 1 + rng() % 100000);
+    test<strie::PlainBpSupport>(bv);
+    test<strie::SparseBpSupport>(bv);
+    test<strie::RrrBpSupport<63>>(bv);
+  }
+
+  // Recursion depth grows with the input.
+  if (test(random_tree(rng, 100)) != 1) {
+    std::cout << "Small input is not explicit" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  unsigned levels = 0;
+  for (int m : {1 << 12, 1 << 16, 1 << 20}) {
+    auto l = test(random_tree(rng, m));
+    if (l < levels or l > strie::kBpMaxLevel + 1) {
+      std::cout << m << ": " << l << " levels" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    levels = l;
+  }
   std::cout << "OK" << std::endl;
 }
@@ -0,0 +1,92 @@
+#include <strie/build_best.hpp>
+#include <strie/datasets.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+void fail(const std::string& msg) {
+  std::cerr << msg << std::endl;
+  exit(EXIT_FAILURE);
+}
+
+void test_stats() {
+  // root, a, ab, abc, b: fanouts 2, 1, 1
+  std::vector<std::string> keys = {"a", "abc", "b"};
+  auto s = strie::key_set_stats(keys.begin(), keys.end());
+  auto near = [](double a, double b) { return std::abs(a - b) < 1e-9; };
+  if (s.num_keys != 3 or s.sample_keys != 3 or !near(s.avg_length, 5.0 / 3) or !near(s.nodes_per_key, 5.0 / 3))
+    fail("stats: sizes");
+  if (!near(s.shared_prefix_ratio, 1.0 / 9) or !near(s.unary_ratio, 2.0 / 3) or !near(s.avg_fanout, 4.0 / 3))
+    fail("stats: shape");
+  if (!near(s.fanout_histogram[0], 2.0 / 3) or !near(s.fanout_histogram[1], 1.0 / 3))
+    fail("stats: fanout histogram");
+  // Root: 3 keys * 1.5; a: 2 * 1; ab: 1 * 1; leaves abc, b: 0.5 each
+  if (!near(s.scanned_labels, 8.5 / 3) or !near(s.branching_nodes, 1.0))
+    fail("stats: paths");
+
+  // A sample of a large set has the shape of the set.
+  auto urls = strie::datasets::generate(strie::datasets::Shape::kUrls, 100000, 1);
+  auto all = strie::key_set_stats(urls.begin(), urls.end(), urls.size());
+  auto sample = strie::key_set_stats(urls.begin(), urls.end(), 4096);
+  if (sample.sample_keys > 4096 or sample.num_keys != urls.size())
+    fail("stats: sample size");
+  if (std::abs(sample.nodes_per_key / all.nodes_per_key - 1) > 0.1
+      or std::abs(sample.avg_length / all.avg_length - 1) > 0.1)
+    fail("stats: sample");
+
+  std::vector<std::string> none;
+  if (strie::key_set_stats(none.begin(), none.end()).sample_keys != 0)
+    fail("stats: empty");
+}
+
+template<typename T>
+void test_trie(const strie::AnyTrie& trie, const std::vector<std::string>& keys) {
+  if (trie.size() != keys.size() or trie.empty())
+    fail(std::string(trie.name()) + ": size");
+  if (!trie.get<T>() or trie.get<T>()->size() != keys.size() or trie.get<strie::SmallLouds>())
+    fail(std::string(trie.name()) + ": get");
+  for (auto& k : keys)
+    if (!trie.contains(k) or trie.contains(k + '\xff'))
+      fail(std::string(trie.name()) + ": contains " + k);
+
+  std::stringstream ss;
+  trie.save(ss, strie::image::Supports::kStore);
+  strie::image::Reader r(ss);
+  T loaded;
+  strie::image::load(loaded, r);
+  if (r.type() != trie.type() or loaded.size() != keys.size() or !loaded.contains(keys.back()))
+    fail(std::string(trie.name()) + ": save");
+}
+
+void test_build(const strie::AnyTrie& trie, const std::vector<std::string>& keys) {
+  switch (trie.type()) {
+    case strie::image::Type::kLouds: test_trie<strie::Louds>(trie, keys); break;
+    case strie::image::Type::kDfuds: test_trie<strie::DfudsTrie>(trie, keys); break;
+    case strie::image::Type::kCentroidPathTree: test_trie<strie::CentroidPathTree>(trie, keys); break;
+  }
+}
+
+int main() {
+  test_stats();
+
+  using strie::Objective;
+  using strie::datasets::Shape;
+  for (auto& [name, shape] : strie::datasets::shapes()) {
+    auto keys = strie::datasets::generate(shape, 20000, 1);
+    for (auto objective : {Objective::kSpace, Objective::kLatency}) {
+      auto trie = strie::build_best(keys.begin(), keys.end(), objective);
+      test_build(trie, keys);
+      // Louds is the smallest; on long shared prefixes a centroid path
+      // decomposition saves a select per byte.
+      auto expected = objective == Objective::kLatency and shape == Shape::kPrefix
+          ? strie::image::Type::kCentroidPathTree : strie::image::Type::kLouds;
+      if (trie.type() != expected)
+        fail(std::string(name) + ": chose " + trie.name());
+    }
+  }
+  std::cout << "OK" << std::endl;
+}
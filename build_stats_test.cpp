@@ -0,0 +1,78 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <set>
+#include <algorithm>
+
+void check_phases(const strie::BuildStats& stats, std::vector<std::string> names, size_t num_nodes) {
+  std::vector<std::string> got;
+  for (auto& p : stats.phases) {
+    got.push_back(p.name);
+    if (p.seconds < 0 or p.peak_rss == 0) {
+      std::cerr << p.name << ": " << p.seconds << "s " << p.peak_rss << "B" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  if (got != names or stats.num_nodes != num_nodes) {
+    stats.print(std::cerr);
+    exit(EXIT_FAILURE);
+  }
+}
+
+template<typename T>
+void test_contains(const T& trie, const std::vector<std::string>& keys,
+                   const std::vector<std::string>& queries) {
+  for (auto& q : queries) {
+    if (trie.contains(q) != std::binary_search(keys.begin(), keys.end(), q)) {
+      std::cerr << q << ": " << trie.contains(q) << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+int main() {
+  std::mt19937 rng(0);
+  std::set<std::string> st = {""};
+  while (st.size() < 20000) {
+    std::string s(1 + rng() % 10, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    st.insert(s);
+  }
+  std::vector<std::string> keys(st.begin(), st.end());
+  std::set<std::string> prefixes;
+  for (auto& k : keys)
+    for (size_t i = 0; i <= k.size(); i++)
+      prefixes.insert(k.substr(0, i));
+  if (strie::count_trie_nodes(keys.begin(), keys.end()) != prefixes.size()) {
+    std::cerr << "count_trie_nodes: " << strie::count_trie_nodes(keys.begin(), keys.end())
+              << " != " << prefixes.size() << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::vector<std::string> queries(keys.begin(), keys.end());
+  for (int i = 0; i < 20000; i++) {
+    std::string s(rng() % 11, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    queries.push_back(s);
+  }
+
+  strie::Louds louds(keys.begin(), keys.end());
+  check_phases(louds.build_stats(), {"validate", "count", "traverse", "rank_select"}, prefixes.size());
+  test_contains(louds, keys, queries);
+  strie::DfudsTrie dfuds(keys.begin(), keys.end());
+  check_phases(dfuds.build_stats(),
+               {"validate", "count", "traverse", "rank_select", "bp_support", "leaf_rank"},
+               prefixes.size());
+  test_contains(dfuds, keys, queries);
+  // One centroid path per key: the end label makes every key a leaf.
+  strie::CentroidPathTree cpt(keys.begin(), keys.end());
+  check_phases(cpt.build_stats(),
+               {"decompose", "count", "traverse", "rank_select", "bp_support", "branch_supports"},
+               keys.size());
+  test_contains(cpt, keys, queries);
+  std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,84 @@
+#include <strie/builder.hpp>
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+#include <strie/double_array.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+
+template<typename T>
+void test_build(const std::vector<std::string>& input, const std::vector<std::string>& keys,
+                const std::vector<std::string>& queries) {
+  auto trie = strie::build_unsorted<T>(input.begin(), input.end(), 4);
+  for (auto& q : queries) {
+    if (trie.contains(q) != std::binary_search(keys.begin(), keys.end(), q)) {
+      std::cerr << q << ": " << trie.contains(q) << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+void test_sort(const std::vector<std::string>& input, const std::vector<std::string>& keys,
+               unsigned num_threads) {
+  auto views = strie::sorted_unique_views(input.begin(), input.end(), num_threads);
+  if (not std::equal(views.begin(), views.end(), keys.begin(), keys.end())) {
+    std::cerr << "Not sorted with " << num_threads << " threads" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+int main() {
+  std::mt19937 rng(0);
+  std::vector<std::string> input;
+  // Duplicates, long shared prefixes, and bytes above 0x7f
+  std::string common(100, 'p');
+  for (int i = 0; i < 200000; i++) {
+    std::string s(1 + rng() % 12, 'a');
+    for (auto& c : s) c = rng() % 3 ? 'a' + rng() % 4 : 0x80 + rng() % 0x80;
+    if (rng() % 4 == 0)
+      s = common + s;
+    input.push_back(s);
+    if (rng() % 3 == 0)
+      input.push_back(s);
+  }
+  std::shuffle(input.begin(), input.end(), rng);
+  auto keys = input;
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+  for (unsigned t : {1, 2, 4})
+    test_sort(input, keys, t);
+  // Small inputs and the empty key
+  for (int n : {0, 1, 5, 40}) {
+    std::vector<std::string> small(input.begin(), input.begin() + n);
+    small.push_back("");
+    auto sorted = small;
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    test_sort(small, sorted, 2);
+  }
+  // A chain of prefixes, "a", "aa", ..., is as deep as it is long.
+  std::vector<std::string> chain;
+  for (int i = 1; i <= 10000; i++)
+    chain.emplace_back(i, 'a');
+  auto shuffled = chain;
+  std::shuffle(shuffled.begin(), shuffled.end(), rng);
+  for (unsigned t : {1, 4})
+    test_sort(shuffled, chain, t);
+
+  std::vector<std::string> queries(keys.begin(), keys.end());
+  for (int i = 0; i < 20000; i++) {
+    std::string s(1 + rng() % 12, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    queries.push_back(s);
+  }
+  test_build<strie::Louds>(input, keys, queries);
+  test_build<strie::DfudsTrie>(input, keys, queries);
+  test_build<strie::CentroidPathTree>(input, keys, queries);
+  test_build<strie::DoubleArrayTrie>(input, keys, queries);
+  std::cout << "OK" << std::endl;
+}
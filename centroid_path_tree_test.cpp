@@ -0,0 +1,102 @@
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <set>
+#include <algorithm>
+#include <memory>
+
+template<typename T>
+void test_trie(const T& trie, const std::vector<std::string>& keys, const std::vector<std::string>& others) {
+  for (auto& key : keys) {
+    if (!trie.contains(key)) {
+      std::cerr << key << " is not contained" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (auto& key : others) {
+    if (trie.contains(key)) {
+      std::cerr << key << " is contained!" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+void test_ids(const strie::CentroidPathTree& trie, const std::vector<std::string>& keys,
+              const std::vector<std::string>& others) {
+  if (trie.size() != keys.size()) {
+    std::cerr << "size " << trie.size() << " != " << keys.size() << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  // Ids are the ranks of the keys.
+  for (size_t i = 0; i < keys.size(); i++) {
+    auto id = trie.lookup(keys[i]);
+    if (!id or *id != i or trie.access(i) != keys[i]) {
+      std::cerr << keys[i] << ": id " << (id ? std::to_string(*id) : "none") << " of rank " << i
+                << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (auto& key : others) {
+    if (trie.lookup(key)) {
+      std::cerr << key << " has an id" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+int main() {
+  std::mt19937 rng(0);
+  // Short keys over a small alphabet, many of them prefixes of others
+  std::set<std::string> st, ot;
+  while (st.size() < 20000) {
+    std::string s(1 + rng() % 10, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    (rng() % 2 ? st : ot).insert(s);
+  }
+  std::vector<std::string> keys(st.begin(), st.end()), others;
+  std::set_difference(ot.begin(), ot.end(), st.begin(), st.end(), std::back_inserter(others));
+
+  test_trie(strie::CentroidPathTreeRaw(keys.begin(), keys.end()), keys, others);
+  {
+    // CentroidPathTreeRaw owns its labels; the keys may go first.
+    auto copies = std::make_unique<std::vector<std::string>>(keys);
+    strie::CentroidPathTreeRaw raw(copies->begin(), copies->end());
+    copies.reset();
+    test_trie(raw, keys, others);
+  }
+  test_trie(strie::CentroidPathTree(keys.begin(), keys.end()), keys, others);
+  test_ids(strie::CentroidPathTree(keys.begin(), keys.end()), keys, others);
+
+  // Zipfian access weights
+  std::vector<double> weights(keys.size());
+  for (auto& w : weights) w = 1.0 / (1 + rng() % keys.size());
+  test_trie(strie::CentroidPathTreeRaw(keys.begin(), keys.end(), weights.begin()), keys, others);
+  test_trie(strie::CentroidPathTree(keys.begin(), keys.end(), weights.begin()), keys, others);
+  test_ids(strie::CentroidPathTree(keys.begin(), keys.end(), weights.begin()), keys, others);
+
+  // A long centroid path branching at hundreds of offsets, with many labels
+  // at some of them
+  st.clear(), ot.clear();
+  std::string path(300, 'a');
+  for (auto& c : path) c = 'a' + rng() % 26;
+  for (size_t i = 0; i < 20000; i++)
+    st.insert(path + std::to_string(i));
+  for (size_t t = 0; t < path.size(); t++) {
+    for (int j = 0, m = t % 7 ? 1 : 40; j < m; j++) {
+      auto s = path.substr(0, t) + char('a' + rng() % 26);
+      (rng() % 2 ? st : ot).insert(s);
+      ot.insert(s + 'z');
+    }
+    ot.insert(path.substr(0, t));
+  }
+  keys.assign(st.begin(), st.end());
+  others.clear();
+  std::set_difference(ot.begin(), ot.end(), st.begin(), st.end(), std::back_inserter(others));
+  test_trie(strie::CentroidPathTree(keys.begin(), keys.end()), keys, others);
+  test_ids(strie::CentroidPathTree(keys.begin(), keys.end()), keys, others);
+  std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,27 @@
+#include <strie/datasets.hpp>
+
+#include <iostream>
+#include <string>
+
+// Writes a synthetic key set, one key per line in sorted order. The same
+// arguments give the same keys on every platform.
+//
+// usage: datagen urls|words|dna|binary|prefix [num_keys] [seed]
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    std::cerr << "usage: datagen urls|words|dna|binary|prefix [num_keys] [seed]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  size_t n = argc > 2 ? std::stoull(argv[2]) : 1000000;
+  uint64_t seed = argc > 3 ? std::stoull(argv[3]) : 0;
+  try {
+    auto keys = strie::datasets::generate(strie::datasets::shape_of(argv[1]), n, seed);
+    std::ios::sync_with_stdio(false);
+    for (auto& k : keys)
+      std::cout << k << '\n';
+  } catch (const std::invalid_argument& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,67 @@
+#include <strie/datasets.hpp>
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+template<typename T>
+void test_trie(const std::vector<std::string>& keys, const std::vector<std::string>& others) {
+  T trie(keys.begin(), keys.end());
+  for (auto& k : keys) {
+    if (!trie.contains(k)) {
+      std::cerr << k << " is not contained" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (auto& k : others) {
+    if (trie.contains(k) != std::binary_search(keys.begin(), keys.end(), k)) {
+      std::cerr << k << ": " << trie.contains(k) << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+// DfudsTrie's for_each, which scans the parentheses, against the keys
+void test_dfuds_for_each(const std::vector<std::string>& keys) {
+  strie::DfudsTrie trie(keys.begin(), keys.end());
+  std::vector<std::string> visited;
+  trie.for_each([&](auto& key) { visited.push_back(key); });
+  if (visited != keys) {
+    std::cerr << "for_each" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+int main() {
+  for (auto& [name, shape] : strie::datasets::shapes()) {
+    auto keys = strie::datasets::generate(shape, 5000, 1);
+    if (keys.size() != 5000 or !std::is_sorted(keys.begin(), keys.end())
+        or std::adjacent_find(keys.begin(), keys.end()) != keys.end()) {
+      std::cerr << name << ": not 5000 sorted distinct keys" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    for (auto& k : keys) {
+      if (k.find('\0') != std::string::npos or k.find('\n') != std::string::npos) {
+        std::cerr << name << ": key with 0 or newline" << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+    if (strie::datasets::generate(shape, 5000, 1) != keys
+        or strie::datasets::generate(shape, 5000, 2) == keys) {
+      std::cerr << name << ": not determined by the seed" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    auto others = strie::datasets::generate(shape, 5000, 3);
+    test_trie<strie::Louds>(keys, others);
+    test_trie<strie::DfudsTrie>(keys, others);
+    test_trie<strie::CentroidPathTree>(keys, others);
+    test_dfuds_for_each(keys);
+  }
+  test_dfuds_for_each({"", "a", "ab", "abc", "b"});
+  test_dfuds_for_each({"a"});
+  std::cout << "OK" << std::endl;
+}
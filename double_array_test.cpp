@@ -0,0 +1,74 @@
+#include <strie/louds.hpp>
+#include <strie/double_array.hpp>
+#include <strie/datasets.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <set>
+#include <algorithm>
+
+void fail(const std::string& msg) {
+  std::cerr << msg << std::endl;
+  exit(EXIT_FAILURE);
+}
+
+// Keys, their proper prefixes and extensions, against the keys and Louds
+void test_trie(const std::vector<std::string>& keys, const std::vector<std::string>& others) {
+  strie::DoubleArrayTrie trie(keys.begin(), keys.end());
+  strie::Louds louds(keys.begin(), keys.end());
+  if (trie.size() != keys.size() or trie.empty() != keys.empty())
+    fail("size " + std::to_string(trie.size()) + " != " + std::to_string(keys.size()));
+
+  std::vector<std::string> queries = others;
+  queries.insert(queries.end(), {"", "\x01", "\xff"});
+  for (auto& k : keys) {
+    queries.push_back(k);
+    for (size_t i = 0; i < k.size(); i += 1 + k.size() / 16)
+      queries.push_back(k.substr(0, i));
+    if (!k.empty())
+      queries.push_back(k.substr(0, k.size() - 1));
+    queries.push_back(k + 'a');
+    queries.push_back(k + '\xff');
+    if (!k.empty())
+      queries.push_back(k.substr(0, k.size() - 1) + char(k.back() + 1));
+  }
+  for (auto& q : queries) {
+    bool expected = std::binary_search(keys.begin(), keys.end(), q);
+    if (trie.contains(q) != expected)
+      fail(q + ": " + std::to_string(trie.contains(q)));
+    if (!keys.empty() and louds.contains(q) != trie.contains(q))
+      fail(q + ": Louds and DoubleArrayTrie differ");
+  }
+
+  std::vector<std::string> visited;
+  trie.for_each([&](auto& key) { visited.push_back(key); });
+  if (visited != keys)
+    fail("for_each");
+}
+
+int main() {
+  std::mt19937 rng(0);
+  // Short keys over a small alphabet, many of them prefixes of others
+  std::set<std::string> st = {""}, ot;
+  while (st.size() < 5000) {
+    std::string s(1 + rng() % 10, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    (rng() % 2 ? st : ot).insert(s);
+  }
+  std::vector<std::string> keys(st.begin(), st.end()), others(ot.begin(), ot.end());
+  test_trie(keys, others);
+
+  // Long tails, which the trie keeps compressed
+  test_trie({"a", "abcdefghij", "abcdefghik", "b", "bcdefghijklmnop"},
+            {"abcdefghi", "abcdefghijk", "bcdefghijklmno", "bcdefghijklmnopq", "bz"});
+  test_trie({"only"}, {"", "o", "onl", "onlyx"});
+
+  for (auto& [name, shape] : strie::datasets::shapes()) {
+    keys = strie::datasets::generate(shape, 5000, 1);
+    others = strie::datasets::generate(shape, 5000, 3);
+    test_trie(keys, others);
+  }
+  std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,66 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/dynamic_trie.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <set>
+
+template<typename T>
+void test_dynamic() {
+  std::mt19937 rng(0);
+  auto gen = [&] {
+    std::string s(1 + rng() % 8, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    return s;
+  };
+  std::set<std::string> st;
+  while (st.size() < 5000)
+    st.insert(gen());
+  strie::DynamicTrie<T> trie(st.begin(), st.end(), 500);
+
+  auto check = [&] {
+    if (trie.size() != st.size()) {
+      std::cerr << "size " << trie.size() << " != " << st.size() << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < 2000; i++) {
+      auto key = gen();
+      if (trie.contains(key) != (st.count(key) > 0)) {
+        std::cerr << key << " is wrong" << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+  };
+  for (int i = 0; i < 20000; i++) {
+    auto key = gen();
+    if (rng() % 2) {
+      if (trie.insert(key) != st.insert(key).second) {
+        std::cerr << "insert " << key << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    } else {
+      if (trie.erase(key) != (st.erase(key) > 0)) {
+        std::cerr << "erase " << key << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+    if (i % 1000 == 0)
+      check();
+  }
+  check();
+  trie.flush();
+  if (trie.base()->size() != st.size()) {
+    std::cerr << "base size " << trie.base()->size() << " != " << st.size() << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  check();
+}
+
+int main() {
+  test_dynamic<strie::Louds>();
+  test_dynamic<strie::DfudsTrie>();
+  std::cout << "OK" << std::endl;
+}
@@ -1,6 +1,7 @@
 #include <strie/louds.hpp>
 #include <strie/dfuds.hpp>
 #include <strie/centroid_path_tree.hpp>
+#include <strie/double_array.hpp>
 
 template<typename D>
 void test_string_collection() {
@@ -28,5 +29,6 @@ int main() {
 //  test_string_collection<strie::DfudsTrie>();
 //  test_string_collection<strie::CentroidPathTreeRaw>();
   test_string_collection<strie::CentroidPathTree>();
+  test_string_collection<strie::DoubleArrayTrie>();
   std::cout << "OK" << std::endl;
 }
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/hugepage.hpp>
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+// Lookup time and dTLB load misses of `contains`, with 4KB pages and with
+// strie::hugepages enabled. Each configuration runs in its own process since
+// the huge page mode is process-wide.
+//
+// usage: hugepage_bench [louds|dfuds] [key_file|-] [off|on]
+
+namespace {
+
+class DtlbCounter {
+  int fd_;
+ public:
+  DtlbCounter() {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB
+        | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+        | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+  ~DtlbCounter() {
+    if (fd_ != -1)
+      close(fd_);
+  }
+  bool available() const { return fd_ != -1; }
+  void start() {
+    if (!available()) return;
+    ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+  }
+  uint64_t stop() {
+    uint64_t cnt = 0;
+    if (!available()) return cnt;
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(fd_, &cnt, sizeof(cnt)) != sizeof(cnt))
+      cnt = 0;
+    return cnt;
+  }
+};
+
+const char* mode_name(strie::hugepages::Mode m) {
+  switch (m) {
+    case strie::hugepages::Mode::kHugeTLB: return "hugetlb";
+    case strie::hugepages::Mode::kTransparent: return "thp";
+    default: return "4k";
+  }
+}
+
+template<typename T>
+void bench(const std::vector<std::string>& keys) {
+  T trie(keys.begin(), keys.end());
+  auto queries = keys;
+  std::shuffle(queries.begin(), queries.end(), std::mt19937(0));
+  queries.resize(std::min<size_t>(queries.size(), 1000000));
+
+  DtlbCounter dtlb;
+  size_t found = 0;
+  dtlb.start();
+  auto start = std::chrono::steady_clock::now();
+  for (auto& q : queries)
+    found += trie.contains(q);
+  auto sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  auto misses = dtlb.stop();
+  if (found != queries.size()) {
+    std::cerr << "Missing keys!" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::cout << mode_name(strie::hugepages::mode()) << '\t'
+            << sec * 1e9 / queries.size() << '\t';
+  if (dtlb.available())
+    std::cout << (double) misses / queries.size();
+  else
+    std::cout << "n/a";
+  std::cout << std::endl;
+}
+
+int run(const std::string& type, const std::vector<std::string>& keys, bool huge) {
+  if (huge)
+    strie::hugepages::enable();
+  if (type == "louds") {
+    bench<strie::Louds>(keys);
+  } else if (type == "dfuds") {
+    bench<strie::DfudsTrie>(keys);
+  } else {
+    std::cerr << "Unknown type: " << type << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  std::string type = argc > 1 ? argv[1] : "louds";
+  std::vector<std::string> keys;
+  if (argc > 2 and std::string(argv[2]) != "-") {
+    std::ifstream ifs(argv[2]);
+    for (std::string s; std::getline(ifs, s); )
+      keys.push_back(s);
+  } else {
+    std::mt19937 rng(0);
+    for (int i = 0; i < 4000000; i++) {
+      std::string s(4 + rng() % 12, 'a');
+      for (auto& c : s) c = 'a' + rng() % 26;
+      keys.push_back(s);
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+  std::cout << "pages\tns/query\tdTLB misses/query" << std::endl;
+  if (argc > 3)
+    return run(type, keys, std::string(argv[3]) == "on");
+  for (bool huge : {false, true}) {
+    std::cout.flush();
+    auto pid = fork();
+    if (pid == 0)
+      exit(run(type, keys, huge));
+    int status;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) or WEXITSTATUS(status) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+  }
+}
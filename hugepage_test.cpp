@@ -0,0 +1,88 @@
+#include <strie/hugepage.hpp>
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <set>
+#include <algorithm>
+
+constexpr size_t kPoolPages = 2;
+
+template<typename T>
+void test_trie(const std::vector<std::string>& keys, const std::vector<std::string>& others) {
+  T trie(keys.begin(), keys.end());
+  for (auto& key : keys) {
+    if (!trie.contains(key)) {
+      std::cerr << key << " is not contained" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (auto& key : others) {
+    if (trie.contains(key)) {
+      std::cerr << key << " is contained!" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+// Buffers past the pool bound fall back to transparent huge pages, and
+// freed MAP_HUGETLB buffers return to the pool.
+void test_allocator(strie::hugepages::Mode mode) {
+  std::vector<strie::hugepage_vector<char>> buffers;
+  for (size_t i = 0; i < kPoolPages + 2; i++) {
+    buffers.emplace_back(strie::hugepages::kPageSize, char(i));
+    if (strie::hugepages::is_hugetlb(buffers.back().data()) and i >= kPoolPages) {
+      std::cerr << "buffer " << i << " is past the pool" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (size_t i = 0; i < buffers.size(); i++) {
+    if (buffers[i].front() != char(i) or buffers[i].back() != char(i)) {
+      std::cerr << "buffer " << i << " is corrupted" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  bool hugetlb = strie::hugepages::is_hugetlb(buffers.front().data());
+  std::cout << "first buffer on " << (hugetlb ? "hugetlb" : "thp") << " pages" << std::endl;
+  if (mode == strie::hugepages::Mode::kTransparent and hugetlb) {
+    std::cerr << "MAP_HUGETLB without reserved huge pages" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  buffers.clear();
+  if (strie::hugepages::pool_used() != 0) {
+    std::cerr << strie::hugepages::pool_used() << " bytes left in the pool" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  strie::hugepage_vector<char> again(strie::hugepages::kPageSize);
+  if (hugetlb and !strie::hugepages::is_hugetlb(again.data())) {
+    std::cerr << "the pool is not reused" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+int main() {
+  // Every test runs with huge pages on, whether the host reserved any or not
+  auto mode = strie::hugepages::enable(kPoolPages * strie::hugepages::kPageSize);
+  if (mode == strie::hugepages::Mode::kNone) {
+    std::cerr << "huge pages are not enabled" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  test_allocator(mode);
+
+  // Labels of several huge pages, past the pool
+  std::mt19937 rng(0);
+  std::set<std::string> st, ot;
+  while (st.size() < 600000) {
+    std::string s(8 + rng() % 8, 'a');
+    for (auto& c : s) c = 'a' + rng() % 26;
+    (rng() % 8 ? st : ot).insert(s);
+  }
+  std::vector<std::string> keys(st.begin(), st.end()), others;
+  std::set_difference(ot.begin(), ot.end(), st.begin(), st.end(), std::back_inserter(others));
+  test_trie<strie::Louds>(keys, others);
+  test_trie<strie::DfudsTrie>(keys, others);
+  std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,111 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+#include <strie/image.hpp>
+#include <strie/datasets.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <stdexcept>
+
+void fail(const std::string& msg) {
+  std::cerr << msg << std::endl;
+  exit(EXIT_FAILURE);
+}
+
+template<typename T>
+void check_contains(const char* name, const T& trie, const std::vector<std::string>& keys) {
+  if (trie.size() != keys.size())
+    fail(std::string(name) + ": " + std::to_string(trie.size()) + " keys loaded");
+  for (auto& k : keys)
+    if (!trie.contains(k) or trie.contains(k + "\x01"))
+      fail(std::string(name) + ": " + k);
+}
+
+template<typename T, typename F>
+void expect_throw(const char* name, const std::string& image, F&& f) {
+  std::stringstream ss(image);
+  T t;
+  try {
+    f(t, ss);
+  } catch (const std::runtime_error&) {
+    return;
+  }
+  fail(std::string(name) + ": a bad image was loaded");
+}
+
+template<typename T, typename U = T>
+std::string test_image(const char* name, const std::vector<std::string>& keys,
+                       strie::image::Supports supports) {
+  T trie(keys.begin(), keys.end());
+  std::stringstream ss;
+  auto bytes = strie::image::save(trie, ss, supports);
+  auto image = ss.str();
+  if (bytes != image.size())
+    fail(std::string(name) + ": save returned " + std::to_string(bytes));
+
+  // Sections are aligned and their checksums hold.
+  strie::image::Header header;
+  std::memcpy(&header, image.data(), sizeof(header));
+  for (size_t i = 0; i < header.num_sections; i++) {
+    strie::image::Section s;
+    std::memcpy(&s, image.data() + sizeof(header) + i * sizeof(s), sizeof(s));
+    if (s.offset % strie::image::kAlign != 0 or s.offset + s.size > image.size()
+        or strie::image::checksum(image.data() + s.offset, s.size) != s.checksum)
+      fail(std::string(name) + ": section " + s.name);
+  }
+
+  U loaded;
+  strie::image::load(loaded, ss);
+  check_contains(name, loaded, keys);
+  return image;
+}
+
+template<typename T>
+void test_structure(const char* name, const std::vector<std::string>& keys) {
+  using strie::image::Supports;
+  auto small = test_image<T>(name, keys, Supports::kRebuild);
+  auto large = test_image<T>(name, keys, Supports::kStore);
+  if (small.size() >= large.size())
+    fail(std::string(name) + ": images with supports are not larger");
+  std::stringstream ss(large);
+  strie::image::Reader r(ss);
+  if (!r.has("bv") or !r.stores_supports(strie::DefaultRankSelect::kImageId))
+    fail(std::string(name) + ": supports are not stored");
+
+  auto load = [](T& t, std::istream& in) { strie::image::load(t, in); };
+  for (auto len : {size_t(0), size_t(20), large.size() / 2, large.size() - 1})
+    expect_throw<T>(name, large.substr(0, len), load);
+  // A flipped bit in the last section, or in the section table
+  auto corrupt = large;
+  corrupt.back() ^= 1;
+  expect_throw<T>(name, corrupt, load);
+  corrupt = large;
+  corrupt[sizeof(strie::image::Header) + 20] ^= 1;
+  expect_throw<T>(name, corrupt, load);
+  corrupt = large;
+  corrupt[8] = strie::image::kVersion + 1;
+  expect_throw<T>(name, corrupt, load);
+}
+
+int main() {
+  auto keys = strie::datasets::generate(strie::datasets::Shape::kUrls, 20000, 2);
+  test_structure<strie::Louds>("louds", keys);
+  test_structure<strie::DfudsTrie>("dfuds", keys);
+  test_structure<strie::CentroidPathTree>("cpt", keys);
+
+  // Supports stored by another rank/select policy are rebuilt.
+  test_image<strie::FastLouds, strie::Louds>("fast louds", keys, strie::image::Supports::kStore);
+  test_image<strie::SmallDfudsTrie, strie::DfudsTrie>("small dfuds", keys, strie::image::Supports::kStore);
+
+  // Images of another structure are refused.
+  strie::Louds louds(keys.begin(), keys.end());
+  std::stringstream ss;
+  strie::image::save(louds, ss);
+  expect_throw<strie::DfudsTrie>("dfuds from louds", ss.str(),
+                                 [](auto& t, std::istream& in) { strie::image::load(t, in); });
+  std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,14 @@
+/*! \file bit_vectors.hpp
+    \brief bit_vectors.hpp contains classes for uncompressed and compressed bit vector representations.
+	\author Simon Gog
+*/
+#ifndef INCLUDED_SDSL_BITVECTORS
+#define INCLUDED_SDSL_BITVECTORS
+
+#include "int_vector.hpp"
+#include "bit_vector_il.hpp"
+#include "rrr_vector.hpp"
+#include "sd_vector.hpp"
+#include "hyb_vector.hpp"
+
+#endif
@@ -0,0 +1,84 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+#include <strie/double_array.hpp>
+#include <strie/louds_filter.hpp>
+#include <strie/builder.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <random>
+#include <set>
+
+// Builds over keys in one byte arena, as from an mmapped file.
+template<typename T, typename It>
+void test_keys(It begin, It end, const std::set<std::string>& keys,
+               const std::vector<std::string>& queries) {
+  T trie(begin, end);
+  for (auto& q : queries) {
+    if (trie.contains(q) != (keys.count(q) > 0)) {
+      std::cerr << q << ": " << trie.contains(q) << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+template<typename It>
+void test_filter(It begin, It end, const std::set<std::string>& keys) {
+  strie::LoudsFilter filter(begin, end);
+  for (auto& k : keys) {
+    if (!filter.may_contain(k)) {
+      std::cerr << k << ": false negative" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+int main() {
+  std::mt19937 rng(0);
+  std::set<std::string> st;
+  while (st.size() < 20000) {
+    std::string s(1 + rng() % 10, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    st.insert(s);
+  }
+  std::string arena;
+  for (auto& s : st)
+    arena += s;
+  std::vector<std::pair<const char*, size_t>> ranges;
+  std::vector<std::string_view> views;
+  size_t off = 0;
+  for (auto& s : st) {
+    ranges.emplace_back(arena.data() + off, s.size());
+    views.push_back(std::string_view(arena).substr(off, s.size()));
+    off += s.size();
+  }
+  std::vector<std::string> queries(st.begin(), st.end());
+  for (int i = 0; i < 20000; i++) {
+    std::string s(1 + rng() % 10, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    queries.push_back(s);
+  }
+
+  test_keys<strie::Louds>(ranges.begin(), ranges.end(), st, queries);
+  test_keys<strie::DfudsTrie>(ranges.begin(), ranges.end(), st, queries);
+  test_keys<strie::CentroidPathTree>(ranges.begin(), ranges.end(), st, queries);
+  test_keys<strie::DoubleArrayTrie>(ranges.begin(), ranges.end(), st, queries);
+  test_keys<strie::Louds>(views.begin(), views.end(), st, queries);
+  test_keys<strie::CentroidPathTree>(views.begin(), views.end(), st, queries);
+  test_filter(ranges.begin(), ranges.end(), st);
+
+  auto unsorted = ranges;
+  std::shuffle(unsorted.begin(), unsorted.end(), rng);
+  auto trie = strie::build_unsorted<strie::DfudsTrie>(unsorted.begin(), unsorted.end(), 2);
+  for (auto& q : queries) {
+    if (trie.contains(q) != (st.count(q) > 0)) {
+      std::cerr << q << ": " << trie.contains(q) << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,112 @@
+#include <strie/louds_filter.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <set>
+
+using Suffix = strie::LoudsFilter::Suffix;
+
+void test_filter(const std::set<std::string>& st, Suffix type, unsigned bits) {
+  strie::LoudsFilter filter(st.begin(), st.end(), type, bits);
+  std::mt19937 rng(1);
+  auto gen = [&] {
+    std::string s(1 + rng() % 12, 'a');
+    for (auto& c : s) c = 'a' + rng() % 26;
+    return s;
+  };
+  for (auto& key : st) {
+    if (!filter.may_contain(key) or !filter.may_contain_range(key, key)) {
+      std::cerr << key << " is missing" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  size_t fp = 0, neg = 0, range_fp = 0, range_neg = 0;
+  for (int i = 0; i < 100000; i++) {
+    auto key = gen();
+    bool in = st.count(key);
+    bool may = filter.may_contain(key);
+    if (in and !may) {
+      std::cerr << key << " is missing" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if (!in) {
+      neg++;
+      fp += may;
+    }
+    // Short ranges, most of them empty
+    auto lo = gen(), hi = lo;
+    hi.back() += 1 + rng() % 2;
+    auto it = st.lower_bound(lo);
+    bool range_in = it != st.end() and *it <= hi;
+    bool range_may = filter.may_contain_range(lo, hi);
+    if (range_in and !range_may) {
+      std::cerr << "[" << lo << ", " << hi << "] is missing" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if (!range_in) {
+      range_neg++;
+      range_fp += range_may;
+    }
+  }
+  std::cout << "suffix " << int(type) << ':' << bits << "\t"
+            << filter.bits_per_key() << " bits/key\t"
+            << "point fpr " << double(fp) / neg << "\t"
+            << "range fpr " << double(range_fp) / std::max<size_t>(1, range_neg) << std::endl;
+}
+
+// The empty key, keys that are prefixes of others, and every byte as a
+// label, against bytes the keys do not use
+void test_edges() {
+  std::set<std::string> st = {"", "a", "ab", "abc", "b", std::string(1, '\0'), std::string("b\0", 2)};
+  for (int c = 1; c < 256; c += 3)
+    st.insert(std::string("x") + char(c) + "yz");
+  for (auto type : {Suffix::kNone, Suffix::kHash, Suffix::kReal}) {
+    strie::LoudsFilter filter(st.begin(), st.end(), type, 8);
+    for (auto& key : st) {
+      if (!filter.may_contain(key) or !filter.may_contain_range(key, key)) {
+        std::cerr << "edge key of " << key.size() << " bytes is missing" << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+    if (!filter.may_contain_range("aa", "ab") or !filter.may_contain_range("x", "x\x02")
+        or filter.may_contain_range("c", "x") or filter.may_contain_range("y", "z")) {
+      std::cerr << "edge range is wrong" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  std::vector<std::string> none;
+  strie::LoudsFilter empty(none.begin(), none.end());
+  if (empty.may_contain("") or empty.may_contain_range("", "z")) {
+    std::cerr << "empty filter is not empty" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+int main() {
+  std::mt19937 rng(0);
+  std::set<std::string> st;
+  while (st.size() < 100000) {
+    std::string s(1 + rng() % 12, 'a');
+    for (auto& c : s) c = 'a' + rng() % 26;
+    st.insert(s);
+  }
+  test_filter(st, Suffix::kNone, 0);
+  test_filter(st, Suffix::kHash, 4);
+  test_filter(st, Suffix::kHash, 8);
+  test_filter(st, Suffix::kReal, 4);
+  test_filter(st, Suffix::kReal, 8);
+  test_filter(st, Suffix::kReal, 16);
+  test_edges();
+
+  // Range filtering well under 16 bits per key at the default suffix
+  strie::LoudsFilter filter(st.begin(), st.end());
+  std::cout << "default\t" << filter.bits_per_key() << " bits/key\t"
+            << filter.dense_levels() << " dense levels" << std::endl;
+  if (filter.bits_per_key() >= 16) {
+    std::cerr << filter.bits_per_key() << " bits/key" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::cout << "OK" << std::endl;
+}
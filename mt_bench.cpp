@@ -0,0 +1,144 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/double_array.hpp>
+#include <strie/numa.hpp>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+// Throughput of `contains` on N threads sharing one trie.
+// Threads are pinned either compactly (filling a NUMA node before the next)
+// or scattered round-robin over nodes. The trie is built by the main thread,
+// so its pages live on the node of the first CPU.
+//
+// usage: mt_bench [louds|dfuds][_fast|_small]|double_array [key_file|-] [max_threads]
+
+namespace {
+
+std::vector<int> placement(const std::vector<strie::numa::Node>& nodes, bool scatter) {
+  std::vector<int> cpus;
+  if (!scatter) {
+    for (auto& n : nodes)
+      cpus.insert(cpus.end(), n.cpus.begin(), n.cpus.end());
+    return cpus;
+  }
+  for (size_t i = 0; ; i++) {
+    bool any = false;
+    for (auto& n : nodes) if (i < n.cpus.size()) {
+      cpus.push_back(n.cpus[i]);
+      any = true;
+    }
+    if (!any)
+      break;
+  }
+  return cpus;
+}
+
+template<typename T>
+double throughput(const T& trie, const std::vector<std::string>& queries, const std::vector<int>& cpus, size_t nt) {
+  std::atomic<size_t> ready = 0;
+  std::atomic<bool> go = false;
+  std::atomic<size_t> found = 0;
+  std::vector<std::thread> ths;
+  for (size_t t = 0; t < nt; t++) {
+    ths.emplace_back([&, t] {
+      strie::numa::pin(cpus[t % cpus.size()]);
+      ++ready;
+      while (!go)
+        std::this_thread::yield();
+      size_t cnt = 0;
+      for (size_t i = t; i < queries.size() + t; i++)
+        cnt += trie.contains(queries[i % queries.size()]);
+      found += cnt;
+    });
+  }
+  while (ready < nt)
+    std::this_thread::yield();
+  auto start = std::chrono::steady_clock::now();
+  go = true;
+  for (auto& th : ths)
+    th.join();
+  auto sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  if (found != nt * queries.size()) {
+    std::cerr << "Missing keys!" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  return nt * queries.size() / sec / 1e6;
+}
+
+template<typename T>
+void bench(const std::vector<std::string>& keys, size_t max_threads) {
+  strie::numa::pin(strie::numa::nodes()[0].cpus[0]);
+  T trie(keys.begin(), keys.end());
+  auto queries = keys;
+  std::shuffle(queries.begin(), queries.end(), std::mt19937(0));
+  queries.resize(std::min<size_t>(queries.size(), 1000000));
+
+  auto nodes = strie::numa::nodes();
+  std::cout << "numa nodes: " << nodes.size() << ", cpus: " << strie::numa::allowed_cpus().size() << std::endl;
+  std::cout << "placement\tthreads\tMq/s\tspeedup\tefficiency" << std::endl;
+  for (bool scatter : {false, true}) {
+    if (scatter and nodes.size() < 2)
+      break;
+    auto cpus = placement(nodes, scatter);
+    double base = 0;
+    for (size_t nt = 1; ; nt = std::min(nt * 2, max_threads)) {
+      auto mqps = throughput(trie, queries, cpus, nt);
+      if (nt == 1)
+        base = mqps;
+      std::cout << (scatter ? "scatter" : "compact") << '\t' << nt << '\t' << mqps << '\t'
+                << mqps / base << '\t' << mqps / base / nt << std::endl;
+      if (nt == max_threads)
+        break;
+    }
+  }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  std::string type = argc > 1 ? argv[1] : "louds";
+  std::vector<std::string> keys;
+  if (argc > 2 and std::string(argv[2]) != "-") {
+    std::ifstream ifs(argv[2]);
+    for (std::string s; std::getline(ifs, s); )
+      keys.push_back(s);
+  } else {
+    std::mt19937 rng(0);
+    for (int i = 0; i < 1000000; i++) {
+      std::string s(4 + rng() % 12, 'a');
+      for (auto& c : s) c = 'a' + rng() % 26;
+      keys.push_back(s);
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  size_t max_threads = argc > 3 ? std::stoul(argv[3]) : std::thread::hardware_concurrency();
+  max_threads = std::max<size_t>(max_threads, 1);
+
+  if (type == "louds") {
+    bench<strie::Louds>(keys, max_threads);
+  } else if (type == "louds_fast") {
+    bench<strie::FastLouds>(keys, max_threads);
+  } else if (type == "louds_small") {
+    bench<strie::SmallLouds>(keys, max_threads);
+  } else if (type == "dfuds") {
+    bench<strie::DfudsTrie>(keys, max_threads);
+  } else if (type == "dfuds_fast") {
+    bench<strie::FastDfudsTrie>(keys, max_threads);
+  } else if (type == "dfuds_small") {
+    bench<strie::SmallDfudsTrie>(keys, max_threads);
+  } else if (type == "double_array") {
+    bench<strie::DoubleArrayTrie>(keys, max_threads);
+  } else {
+    std::cerr << "Unknown type: " << type << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,248 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+#include <strie/datasets.hpp>
+#include <strie/rank_select.hpp>
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+// Hardware counters per `contains` query: cycles, instructions, LLC misses
+// and branch misses, for Louds, DfudsTrie and CentroidPathTree on the same
+// keys and queries. Keys come from a file or from strie::datasets, so runs
+// on different machines or commits compare on equal footing.
+// Half of the queries are keys, half are keys with the last byte changed.
+// `access` compares CentroidPathTree::access of random ranks with decoding a
+// front-coded array of buckets of 16 keys. `select` times select0 of the
+// Default, Fast and Small presets on a random vector of 2^28 bits, past the
+// caches; keys are not used.
+//
+// usage: perf_bench [louds|dfuds|cpt|all|access|select] [key_file|urls|words|dna|binary|prefix] [num_keys] [seed]
+
+namespace {
+
+class PerfCounters {
+ public:
+  static constexpr size_t kNum = 4;
+  static constexpr const char* kNames[kNum] = {"cycles", "instructions", "LLC-misses", "branch-misses"};
+ private:
+  std::array<int, kNum> fds_;
+  std::array<uint64_t, kNum> counts_{};
+
+  static int _open(uint32_t type, uint64_t config) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+
+ public:
+  PerfCounters() {
+    fds_[0] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    fds_[1] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    fds_[2] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    fds_[3] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+  }
+  ~PerfCounters() {
+    for (auto fd : fds_)
+      if (fd != -1)
+        close(fd);
+  }
+  bool available(size_t i) const { return fds_[i] != -1; }
+  void start() {
+    for (auto fd : fds_) if (fd != -1) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+  void stop() {
+    for (size_t i = 0; i < kNum; i++) if (fds_[i] != -1) {
+      ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fds_[i], &counts_[i], sizeof(uint64_t)) != sizeof(uint64_t))
+        counts_[i] = 0;
+    }
+  }
+  uint64_t count(size_t i) const { return counts_[i]; }
+};
+
+template<typename F>
+void measure(const char* name, size_t num_queries, F&& f) {
+  // Warm up caches and the branch predictor
+  size_t found = 0;
+  for (size_t i = 0; i < std::min<size_t>(num_queries, 10000); i++)
+    found += f(i);
+
+  PerfCounters counters;
+  found = 0;
+  counters.start();
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < num_queries; i++)
+    found += f(i);
+  auto sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  counters.stop();
+
+  std::cout << name << '\t' << sec * 1e9 / num_queries;
+  for (size_t i = 0; i < PerfCounters::kNum; i++) {
+    std::cout << '\t';
+    if (counters.available(i))
+      std::cout << (double) counters.count(i) / num_queries;
+    else
+      std::cout << "n/a";
+  }
+  std::cout << '\t' << found << std::endl;
+}
+
+template<typename T>
+void bench(const char* name, const std::vector<std::string>& keys,
+           const std::vector<std::string>& queries) {
+  T trie(keys.begin(), keys.end());
+  measure(name, queries.size(), [&](size_t i) { return trie.contains(queries[i]); });
+}
+
+// Sorted keys in buckets of kBucket: the first key in full, the others as
+// the length of the prefix shared with the previous key and the rest
+class FrontCoding {
+  static constexpr size_t kBucket = 16;
+  std::vector<size_t> heads_;
+  std::string data_;
+
+ public:
+  explicit FrontCoding(const std::vector<std::string>& keys) {
+    for (size_t i = 0; i < keys.size(); i++) {
+      size_t l = 0;
+      if (i % kBucket == 0) {
+        heads_.push_back(data_.size());
+      } else {
+        auto& p = keys[i-1];
+        while (l < std::min<size_t>({p.size(), keys[i].size(), 255}) and p[l] == keys[i][l])
+          ++l;
+        data_.push_back(l);
+      }
+      data_.append(keys[i], l);
+      data_.push_back('\0');
+    }
+  }
+
+  std::string access(size_t id) const {
+    auto p = data_.data() + heads_[id / kBucket];
+    std::string key(p);
+    p += key.size() + 1;
+    for (size_t i = 0; i < id % kBucket; i++) {
+      key.resize((unsigned char) *p++);
+      auto len = std::strlen(p);
+      key.append(p, len);
+      p += len + 1;
+    }
+    return key;
+  }
+};
+
+// Random ranks decoded to keys; `found` sums the key lengths.
+void bench_access(const std::vector<std::string>& keys, uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  std::vector<size_t> ids(std::max<size_t>(keys.size(), 1000000));
+  for (auto& id : ids)
+    id = rng() % keys.size();
+  strie::CentroidPathTree cpt(keys.begin(), keys.end());
+  measure("cpt_access", ids.size(), [&](size_t i) { return cpt.access(ids[i]).size(); });
+  FrontCoding fc(keys);
+  measure("front_coding", ids.size(), [&](size_t i) { return fc.access(ids[i]).size(); });
+}
+
+template<typename S>
+void bench_select(const char* name, const sdsl::bit_vector& bv, const std::vector<size_t>& queries) {
+  S s;
+  sdsl::util::init_support(s, &bv);
+  measure(name, queries.size(), [&](size_t i) { return s(queries[i]); });
+}
+
+// select0 of random ranks; `found` sums the positions.
+void print_header(const char* what) {
+  std::cout << what << "\tns";
+  for (auto name : PerfCounters::kNames)
+    std::cout << '\t' << name;
+  std::cout << "\t(found)" << std::endl;
+}
+
+void bench_select(uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  sdsl::bit_vector bv(size_t(1) << 28);
+  for (size_t i = 0; i < bv.size() / 64; i++)
+    bv.set_int(i * 64, rng());
+  auto zeros = sdsl::rank_support_v<0, 1>(&bv)(bv.size());
+  std::vector<size_t> queries(1 << 20);
+  for (auto& q : queries)
+    q = 1 + rng() % zeros;
+  bench_select<strie::DefaultRankSelect::select_type<0>>("default", bv, queries);
+  bench_select<strie::FastRankSelect::select_type<0>>("fast", bv, queries);
+  bench_select<strie::SmallRankSelect::select_type<0>>("small", bv, queries);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  std::string type = argc > 1 ? argv[1] : "all";
+  std::string source = argc > 2 ? argv[2] : "urls";
+  size_t n = argc > 3 ? std::stoull(argv[3]) : 1000000;
+  uint64_t seed = argc > 4 ? std::stoull(argv[4]) : 0;
+  if (type == "select") {
+    print_header("preset");
+    bench_select(seed);
+    return 0;
+  }
+
+  std::vector<std::string> keys;
+  bool is_shape = std::any_of(strie::datasets::shapes().begin(), strie::datasets::shapes().end(),
+                              [&](auto& s) { return s.first == source; });
+  if (is_shape) {
+    keys = strie::datasets::generate(strie::datasets::shape_of(source), n, seed);
+  } else {
+    std::ifstream ifs(source);
+    if (!ifs) {
+      std::cerr << "Cannot open " << source << std::endl;
+      return EXIT_FAILURE;
+    }
+    for (std::string s; std::getline(ifs, s); )
+      keys.push_back(s);
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  }
+
+  std::mt19937_64 rng(seed);
+  std::vector<std::string> queries;
+  for (size_t i = 0; i < std::max<size_t>(keys.size(), 1000000); i++) {
+    auto q = keys[rng() % keys.size()];
+    if (i % 2 and !q.empty())
+      q.back() = q.back() == 'a' ? 'b' : 'a';
+    queries.push_back(std::move(q));
+  }
+
+  std::cout << "keys: " << keys.size() << ", queries: " << queries.size() << std::endl;
+  print_header("trie");
+  if (type == "louds" or type == "all")
+    bench<strie::Louds>("louds", keys, queries);
+  if (type == "dfuds" or type == "all")
+    bench<strie::DfudsTrie>("dfuds", keys, queries);
+  if (type == "cpt" or type == "all")
+    bench<strie::CentroidPathTree>("cpt", keys, queries);
+  if (type == "access")
+    bench_access(keys, seed);
+}
@@ -0,0 +1,52 @@
+#include <strie/permutation.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <numeric>
+#include <random>
+#include <algorithm>
+
+template<uint32_t kStep>
+void test_permutation(const std::vector<size_t>& pi) {
+  sdsl::int_vector<> v(pi.size(), 0, 64);
+  for (size_t i = 0; i < pi.size(); i++)
+    v[i] = pi[i];
+  strie::Permutation<kStep> p(v);
+  std::stringstream ss;
+  p.serialize(ss);
+  strie::Permutation<kStep> loaded;
+  loaded.load(ss);
+  for (auto* q : {&p, &loaded}) {
+    if (q->size() != pi.size()) {
+      std::cerr << "size " << q->size() << " != " << pi.size() << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < pi.size(); i++) {
+      if ((*q)[i] != pi[i] or q->inverse(pi[i]) != i) {
+        std::cerr << "step " << kStep << ", n " << pi.size() << ": inverse(" << pi[i] << ") = "
+                  << q->inverse(pi[i]) << " != " << i << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+  }
+}
+
+int main() {
+  std::mt19937_64 rng(0);
+  for (size_t n : {0, 1, 2, 17, 1000, 100000}) {
+    std::vector<size_t> pi(n);
+    // The identity, one long cycle, and random cycles
+    std::iota(pi.begin(), pi.end(), 0);
+    test_permutation<16>(pi);
+    for (size_t i = 0; i < n; i++)
+      pi[i] = (i + 1) % n;
+    test_permutation<1>(pi);
+    test_permutation<16>(pi);
+    std::shuffle(pi.begin(), pi.end(), rng);
+    test_permutation<1>(pi);
+    test_permutation<4>(pi);
+    test_permutation<16>(pi);
+  }
+  std::cout << "OK" << std::endl;
+}
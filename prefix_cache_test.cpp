@@ -0,0 +1,85 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/prefix_cache.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <cstddef>
+
+// Iterator yielding copies of the strings, as a transform iterator does
+struct ByValue {
+  using iterator_category = std::input_iterator_tag;
+  using value_type = std::string;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = std::string;
+  std::vector<std::string>::const_iterator it;
+  std::string operator*() const { return *it; }
+  ByValue& operator++() { ++it; return *this; }
+  bool operator!=(const ByValue& o) const { return it != o.it; }
+};
+
+template<typename T>
+void test_cache(const std::vector<std::string>& keys, const std::vector<std::string>& queries) {
+  strie::PrefixCachedTrie<T> trie(keys.begin(), keys.end(), 6, 256);
+  trie.warm(queries.begin(), queries.end());
+  if (trie.cache_size() == 0) {
+    std::cerr << "Nothing cached" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  for (auto& q : queries) {
+    if (trie.contains(q) != std::binary_search(keys.begin(), keys.end(), q)) {
+      std::cerr << q << ": " << trie.contains(q) << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  strie::PrefixCachedTrie<T> copies(keys.begin(), keys.end(), 6, 256);
+  copies.warm(ByValue{queries.begin()}, ByValue{queries.end()});
+  if (copies.cache_size() != trie.cache_size()) {
+    std::cerr << "Warm from copies cached " << copies.cache_size() << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  for (auto& q : queries) {
+    if (copies.contains(q) != std::binary_search(keys.begin(), keys.end(), q)) {
+      std::cerr << q << ": " << copies.contains(q) << " after warm from copies" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+int main() {
+  std::mt19937 rng(0);
+  // Keys under a few hosts
+  std::vector<std::string> hosts;
+  for (int i = 0; i < 50; i++) {
+    std::string h(3 + rng() % 6, 'a');
+    for (auto& c : h) c = 'a' + rng() % 26;
+    hosts.push_back(h + ".com/");
+  }
+  std::set<std::string> st;
+  std::vector<std::string> queries;
+  while (st.size() < 20000) {
+    std::string s = hosts[rng() % hosts.size()];
+    s.resize(s.size() + rng() % 8, 'a');
+    for (size_t i = s.find('/') + 1; i < s.size(); i++) s[i] = 'a' + rng() % 4;
+    if (rng() % 4)
+      st.insert(s);
+    queries.push_back(s);
+  }
+  for (int i = 0; i < 1000; i++) {
+    std::string s(rng() % 10, 'a');
+    for (auto& c : s) c = 'a' + rng() % 26;
+    queries.push_back(s);
+  }
+  std::vector<std::string> keys(st.begin(), st.end());
+
+  test_cache<strie::Louds>(keys, queries);
+  test_cache<strie::DfudsTrie>(keys, queries);
+  std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,137 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <set>
+#include <algorithm>
+
+template<typename T>
+void test_trie(const std::vector<std::string>& keys, const std::vector<std::string>& others) {
+  T trie(keys.begin(), keys.end());
+  if (trie.size() != keys.size()) {
+    std::cerr << "size " << trie.size() << " != " << keys.size() << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  for (auto& key : keys) {
+    if (!trie.contains(key)) {
+      std::cerr << key << " is not contained" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (auto& key : others) {
+    if (trie.contains(key)) {
+      std::cerr << key << " is contained!" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  std::vector<std::string> listed;
+  trie.for_each([&](const std::string& key) { listed.push_back(key); });
+  if (listed != keys) {
+    std::cerr << "for_each differs" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+// SampledSelect agrees with select_support_mcl on every B bit
+template<uint8_t B, uint32_t kRate>
+void test_sampled_select(const sdsl::bit_vector& bv) {
+  strie::SampledSelect<B, kRate> s;
+  sdsl::util::init_support(s, &bv);
+  sdsl::select_support_mcl<B, 1> ref(&bv);
+  auto count = sdsl::rank_support_v<B, 1>(&bv)(bv.size());
+  for (size_t i = 1; i <= count; i++) {
+    if (s(i) != ref(i)) {
+      std::cerr << "select<" << int(B) << ", " << kRate << ">(" << i << ") = " << s(i)
+                << " != " << ref(i) << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+void test_sampled_select() {
+  std::mt19937_64 rng(0);
+  for (size_t n : {1, 63, 64, 65, 1000, 100000}) {
+    for (int density : {0, 1, 50, 99, 100}) {
+      sdsl::bit_vector bv(n);
+      for (size_t i = 0; i < n; i++)
+        bv[i] = int(rng() % 100) < density;
+      test_sampled_select<0, 128>(bv);
+      test_sampled_select<1, 128>(bv);
+      test_sampled_select<0, 1024>(bv);
+      test_sampled_select<1, 1024>(bv);
+    }
+  }
+}
+
+template<typename T>
+size_t rank_select_bytes(const std::vector<std::string>& keys) {
+  T trie(keys.begin(), keys.end());
+  for (auto& p : trie.build_stats().phases)
+    if (p.name == "rank_select")
+      return p.bytes;
+  std::cerr << "no rank_select phase" << std::endl;
+  exit(EXIT_FAILURE);
+}
+
+// The presets differ: Fast and Small take different supports than Default,
+// and Small less than half of Default's space. Their times are compared by
+// `perf_bench select`.
+void test_policies_differ(const std::vector<std::string>& keys) {
+  auto dflt = rank_select_bytes<strie::Louds>(keys);
+  auto fast = rank_select_bytes<strie::FastLouds>(keys);
+  auto small = rank_select_bytes<strie::SmallLouds>(keys);
+  std::cout << "rank/select bytes: default " << dflt << ", fast " << fast << ", small " << small
+            << std::endl;
+  if (fast == dflt or small >= fast) {
+    std::cerr << "FastRankSelect or SmallRankSelect is not its own preset" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  if (small * 2 > dflt) {
+    std::cerr << "SmallRankSelect is not smaller" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+int main() {
+  test_sampled_select();
+
+  std::mt19937 rng(0);
+  std::set<std::string> st, ot;
+  while (st.size() < 50000) {
+    std::string s(rng() % 12, 'a');
+    for (auto& c : s) c = 'a' + rng() % 8;
+    (rng() % 2 ? st : ot).insert(s);
+  }
+  std::vector<std::string> keys(st.begin(), st.end()), others;
+  std::set_difference(ot.begin(), ot.end(), st.begin(), st.end(), std::back_inserter(others));
+
+  test_trie<strie::Louds>(keys, others);
+  test_trie<strie::FastLouds>(keys, others);
+  test_trie<strie::SmallLouds>(keys, others);
+  test_trie<strie::DfudsTrie>(keys, others);
+  test_trie<strie::FastDfudsTrie>(keys, others);
+  test_trie<strie::SmallDfudsTrie>(keys, others);
+
+  // Nodes of degree over a word, and labels beyond ASCII
+  std::vector<std::string> wide, absent;
+  for (int c = 1; c < 256; c++) {
+    if (c % 3 == 0) {
+      absent.push_back(std::string(1, (char) c));
+      continue;
+    }
+    wide.push_back(std::string(1, (char) c));
+    for (int d = 1; d < 256; d += 7)
+      wide.push_back(std::string(1, (char) c) + (char) d);
+    absent.push_back(std::string(1, (char) c) + (char) 2);
+  }
+  std::sort(wide.begin(), wide.end());
+  test_trie<strie::DfudsTrie>(wide, absent);
+  test_trie<strie::FastDfudsTrie>(wide, absent);
+  test_trie<strie::SmallDfudsTrie>(wide, absent);
+
+  test_policies_differ(keys);
+  std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,47 @@
+#include <strie/scored_dfuds.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <set>
+#include <algorithm>
+
+int main() {
+  std::mt19937 rng(0);
+  std::set<std::string> st;
+  while (st.size() < 20000) {
+    std::string s(1 + rng() % 10, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    st.insert(s);
+  }
+  std::vector<std::string> keys(st.begin(), st.end());
+  std::vector<uint64_t> scores(keys.size());
+  for (auto& s : scores) s = rng() % 100000;
+  strie::ScoredDfudsTrie trie(keys.begin(), keys.end(), scores.begin());
+
+  for (std::string prefix : {"", "a", "ab", "bcd", "dddd", "abcabca", "e"}) {
+    const size_t k = 10;
+    std::vector<std::pair<uint64_t, std::string>> expected;
+    for (size_t i = 0; i < keys.size(); i++)
+      if (keys[i].compare(0, prefix.size(), prefix) == 0)
+        expected.emplace_back(scores[i], keys[i]);
+    std::sort(expected.rbegin(), expected.rend());
+    auto topk = trie.top_k(prefix, k);
+    if (topk.size() != std::min(k, expected.size())) {
+      std::cout << prefix << ": " << topk.size() << " results" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < topk.size(); i++) {
+      auto& [key, score] = topk[i];
+      if (score != expected[i].first or
+          key.compare(0, prefix.size(), prefix) != 0 or
+          !std::binary_search(keys.begin(), keys.end(), key) or
+          scores[std::lower_bound(keys.begin(), keys.end(), key) - keys.begin()] != score) {
+        std::cout << prefix << ": " << key << ' ' << score << " != " << expected[i].second << ' ' << expected[i].first << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+  }
+  std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,5 @@
+typedef unsigned int uint128_t __attribute__((mode(TI)));
+
+int main() {
+    return 0;
+}
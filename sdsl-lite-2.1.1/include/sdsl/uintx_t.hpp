@@ -0,0 +1,16 @@
+#ifndef INCLUDED_SDSL_UINTX_T
+#define INCLUDED_SDSL_UINTX_T
+
+#include <cstdint>
+
+using std::int8_t;
+using std::int16_t;
+using std::int32_t;
+using std::int64_t;
+
+using std::uint8_t;
+using std::uint16_t;
+using std::uint32_t;
+using std::uint64_t;
+
+#endif
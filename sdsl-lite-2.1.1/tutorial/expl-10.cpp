@@ -0,0 +1,17 @@
+#include <iostream>
+#include <sdsl/bit_vectors.hpp>
+
+using namespace std;
+using namespace sdsl;
+
+int main()
+{
+    bit_vector b = {0,1,0,1,1,1,0,0,0,1,1};
+    size_t zeros = rank_support_v<0>(&b)(b.size());
+    bit_vector::select_0_type b_sel(&b);
+
+    for (size_t i=1; i <= zeros; ++i) {
+        cout << b_sel(i) << " ";
+    }
+    cout << endl;
+}
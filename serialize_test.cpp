@@ -0,0 +1,125 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+#include <strie/image.hpp>
+#include <strie/datasets.hpp>
+
+#include <unistd.h>
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+
+template<typename T>
+void check_contains(const char* name, const T& trie, const std::vector<std::string>& keys) {
+  if (trie.size() != keys.size()) {
+    std::cerr << name << ": " << trie.size() << " keys loaded" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  for (auto& k : keys) {
+    if (!trie.contains(k) or trie.contains(k + "\x01")) {
+      std::cerr << name << ": " << k << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+// Images read from a stream, from memory and from a mapped file agree, the
+// words of int_vector sections are 64-byte aligned in the mapping, and
+// images cut short throw from memory too.
+template<typename T>
+void test_round_trip(const char* name, const std::vector<std::string>& keys) {
+  T trie(keys.begin(), keys.end());
+  std::stringstream ss;
+  strie::image::save(trie, ss, strie::image::Supports::kStore);
+  auto image = ss.str();
+
+  T from_stream;
+  strie::image::load(from_stream, ss);
+  check_contains(name, from_stream, keys);
+
+  T from_memory;
+  strie::image::Reader r(image.data(), image.size());
+  strie::image::load(from_memory, r);
+  check_contains(name, from_memory, keys);
+
+  std::string path = "serialize_test_" + std::to_string(getpid()) + ".img";
+  std::ofstream(path, std::ios::binary).write(image.data(), image.size());
+  T from_file;
+  strie::image::load_file(from_file, path);
+  check_contains(name, from_file, keys);
+  {
+    strie::image::MappedFile file(path);
+    strie::image::Header header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    for (size_t i = 0; i < header.num_sections; i++) {
+      strie::image::Section s;
+      std::memcpy(&s, file.data() + sizeof(header) + i * sizeof(s), sizeof(s));
+      auto words = reinterpret_cast<uintptr_t>(file.data() + s.offset + strie::io::kIntVectorHeader);
+      if ((s.name == std::string("bv") or s.name == std::string("leaf")) and words % 64 != 0) {
+        std::cerr << name << ": words of " << s.name << " are not aligned" << std::endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+  }
+  std::remove(path.c_str());
+
+  for (auto len : {size_t(0), size_t(7), image.size() / 2, image.size() - 1}) {
+    T t;
+    try {
+      strie::image::Reader cut(image.data(), len);
+      strie::image::load(t, cut);
+    } catch (const std::runtime_error&) {
+      continue;
+    }
+    std::cerr << name << ": image cut to " << len << " bytes was loaded" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+// A corrupt int_vector length fails as truncation, without allocating it.
+void test_corrupt_length() {
+  sdsl::bit_vector bv(1000, 1);
+  std::stringstream ss;
+  auto bytes = strie::io::write_int_vector(ss, bv);
+  auto data = ss.str();
+  if (bytes != data.size() or bytes != strie::io::kIntVectorHeader + 16 * 8) {
+    std::cerr << "write_int_vector returned " << bytes << " for " << data.size() << " bytes" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  for (int i = 0; i < 7; i++)
+    data[i] = '\xff';
+  std::stringstream cs(data);
+  sdsl::bit_vector loaded;
+  try {
+    strie::io::read_int_vector(cs, loaded);
+  } catch (const std::runtime_error&) {
+    return;
+  }
+  std::cerr << "int_vector with a corrupt length was loaded" << std::endl;
+  exit(EXIT_FAILURE);
+}
+
+int main() {
+  auto keys = strie::datasets::generate(strie::datasets::Shape::kWords, 5000, 1);
+  test_round_trip<strie::Louds>("louds", keys);
+  test_round_trip<strie::DfudsTrie>("dfuds", keys);
+  test_round_trip<strie::CentroidPathTree>("cpt", keys);
+  test_corrupt_length();
+
+  // A missing file throws.
+  strie::Louds louds;
+  try {
+    strie::image::load_file(louds, "serialize_test_missing.img");
+  } catch (const std::runtime_error&) {
+    std::cout << "OK" << std::endl;
+    return 0;
+  }
+  std::cerr << "a missing image was loaded" << std::endl;
+  exit(EXIT_FAILURE);
+}
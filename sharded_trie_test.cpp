@@ -0,0 +1,127 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+#include <strie/sharded_trie.hpp>
+#include <strie/numa.hpp>
+#include <strie/datasets.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <thread>
+#include <system_error>
+
+void fail(const std::string& msg) {
+  std::cerr << msg << std::endl;
+  exit(EXIT_FAILURE);
+}
+
+template<typename T>
+void test_contains(const char* name, const T& trie, const std::vector<std::string>& keys,
+                   const std::vector<std::string>& queries) {
+  if (trie.size() != keys.size())
+    fail(std::string(name) + ": size " + std::to_string(trie.size()));
+  for (auto& q : queries)
+    if (trie.contains(q) != std::binary_search(keys.begin(), keys.end(), q))
+      fail(std::string(name) + ": contains " + q);
+}
+
+std::vector<std::string> make_queries(const std::vector<std::string>& keys) {
+  std::mt19937 rng(0);
+  std::vector<std::string> queries = {"", "\xff", "\xff\xff"};
+  for (auto& k : keys) {
+    queries.push_back(k);
+    queries.push_back(k + "a");
+    if (!k.empty())
+      queries.push_back(k.substr(0, rng() % k.size()));
+  }
+  for (int i = 0; i < 1000; i++)
+    queries.push_back(std::string(1 + rng() % 4, char(rng())));
+  return queries;
+}
+
+void test_keys(const std::vector<std::string>& keys) {
+  auto queries = make_queries(keys);
+  for (size_t k : {1, 3, 8, 300}) {
+    for (bool numa : {false, true}) {
+      strie::ShardOptions options;
+      options.num_shards = k;
+      options.num_threads = 4;
+      options.numa = numa;
+      strie::ShardedTrie<strie::Louds> louds(keys.begin(), keys.end(), options);
+      test_contains("louds", louds, keys, queries);
+      if (louds.num_shards() > std::min(k, keys.size()) or (numa and !keys.empty() and louds.numa_node(0) != strie::numa::nodes()[0].id))
+        fail("louds: " + std::to_string(louds.num_shards()) + " shards");
+      std::vector<std::string> got;
+      louds.for_each([&](auto& key) { got.push_back(key); });
+      if (got != keys)
+        fail("louds: for_each");
+
+      strie::ShardedTrie<strie::DfudsTrie> dfuds(keys.begin(), keys.end(), options);
+      test_contains("dfuds", dfuds, keys, queries);
+
+      strie::ShardedTrie<strie::CentroidPathTree> cpt(keys.begin(), keys.end(), options);
+      test_contains("cpt", cpt, keys, queries);
+      // Global ids are the ranks of the keys, in the range of the key's shard.
+      for (size_t i = 0; i < keys.size(); i++) {
+        auto& key = keys[i];
+        auto id = cpt.lookup(key);
+        if (!id or *id != i or cpt.access(i) != key)
+          fail("cpt: id of " + key);
+        auto s = cpt.shard_of(key);
+        if (*id < cpt.offset(s) or *id >= cpt.offset(s) + cpt.shard(s).size())
+          fail("cpt: shard of " + key);
+      }
+      for (size_t s = 0; s < cpt.num_shards(); s++)
+        if (cpt.offset(s) + cpt.shard(s).size() != (s + 1 < cpt.num_shards() ? cpt.offset(s+1) : keys.size()))
+          fail("cpt: offsets");
+    }
+  }
+}
+
+void test_numa() {
+  if (strie::numa::parse_cpulist("0-3,8,10-11\n") != std::vector<int>{0, 1, 2, 3, 8, 10, 11}
+      or !strie::numa::parse_cpulist("").empty())
+    fail("parse_cpulist");
+  auto allowed = strie::numa::allowed_cpus();
+  size_t num_cpus = 0;
+  for (auto& node : strie::numa::nodes()) {
+    for (auto c : node.cpus)
+      if (!std::binary_search(allowed.begin(), allowed.end(), c))
+        fail("numa: cpu " + std::to_string(c) + " of node " + std::to_string(node.id) + " is not allowed");
+    num_cpus += node.cpus.size();
+  }
+  if (num_cpus != allowed.size())
+    fail("numa: nodes hold " + std::to_string(num_cpus) + " cpus");
+  // Failures to pin are reported, not ignored.
+  std::thread([] {
+    for (auto cpus : {std::vector<int>{}, std::vector<int>{-1}, std::vector<int>{1 << 20}}) {
+      try {
+        strie::numa::pin(cpus);
+        fail("numa: pin did not throw");
+      } catch (const std::system_error&) {
+      }
+    }
+    strie::numa::pin(strie::numa::nodes()[0].cpus);
+  }).join();
+}
+
+int main() {
+  using strie::datasets::Shape;
+  test_numa();
+  // Few first bytes, all keys sharing one, and many first bytes
+  test_keys(strie::datasets::generate(Shape::kDna, 3000, 1));
+  test_keys(strie::datasets::generate(Shape::kUrls, 3000, 1));
+  auto binary = strie::datasets::generate(Shape::kBinary, 3000, 1);
+  binary.insert(binary.begin(), "");
+  test_keys(binary);
+  test_keys({"a"});
+  test_keys({});
+
+  strie::ShardedTrie<strie::Louds> empty;
+  if (!empty.empty() or empty.contains(""))
+    fail("empty");
+  std::cout << "OK" << std::endl;
+}
@@ -0,0 +1,51 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/snapshot_trie.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+int main() {
+  // Every version contains the common keys and only one of the tagged ones.
+  std::vector<std::string> common;
+  for (int i = 0; i < 1000; i++)
+    common.push_back("key" + std::to_string(i));
+  auto version = [&](int v) {
+    auto keys = common;
+    keys.push_back("version" + std::to_string(v % 2));
+    std::sort(keys.begin(), keys.end());
+    return std::make_unique<const strie::DfudsTrie>(keys.begin(), keys.end());
+  };
+  strie::SnapshotTrie<strie::DfudsTrie> trie(version(0));
+
+  std::atomic<bool> stop = false, failed = false;
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; t++) {
+    readers.emplace_back([&] {
+      while (!stop) {
+        auto s = trie.snapshot();
+        for (auto& key : common)
+          if (!s->contains(key))
+            failed = true;
+        if (s->contains("version0") == s->contains("version1"))
+          failed = true;
+      }
+    });
+  }
+  for (int v = 1; v <= 200; v++)
+    trie.publish(version(v));
+  stop = true;
+  for (auto& th : readers)
+    th.join();
+  trie.reclaim();
+  if (failed or trie.num_retired() != 0) {
+    std::cerr << "Inconsistent snapshot" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::cout << "OK" << std::endl;
+}
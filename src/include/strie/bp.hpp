@@ -2,20 +2,74 @@
 #define SUCCINCT_TRIES__BP_HPP_
 
 #include "findclose.hpp"
+#include "hugepage.hpp"
+#include "io.hpp"
 
 #include <cstdint>
 #include <cassert>
 #include <vector>
 #include <stack>
+#include <algorithm>
+#include <limits>
 
 #include <sdsl/bit_vectors.hpp>
 
 namespace strie {
 
-template<unsigned LEVEL = 0>
+// Each level holds the pioneers of the level above. A level stops the
+// recursion by storing all matches explicitly once they fit in
+// n / kBpExplicitRatio bits, n being the size of the root level, or in
+// kBpMinExplicitBits; the level kBpMaxLevel always does.
+constexpr unsigned kBpMaxLevel = 4;
+constexpr size_t kBpExplicitRatio = 8;
+constexpr size_t kBpMinExplicitBits = 1u << 12;
+// Positions a batch findclose carries from one level to the next, and how
+// far ahead of its position it prefetches.
+constexpr size_t kBpBatch = 64;
+constexpr size_t kBpPrefetch = 8;
+
+// Prefetch the word of bit i of an int_vector of the given width
+template<typename IntVector>
+inline void bp_prefetch(const IntVector& v, size_t i, size_t width = 1) {
+  __builtin_prefetch(v.data() + i * width / 64);
+}
+
+// PioneerBv marks the pioneers of a level and answers rank/select on them:
+// any sdsl bitvector with rank_1_type and select_1_type, e.g. bit_vector
+// (fastest), rrr_vector<B> or sd_vector<> (smallest for sparse pioneers).
+// RankL is the rank of '(' given for the root level.
+template<unsigned LEVEL = 0, typename PioneerBv = sdsl::rrr_vector<>,
+         typename RankL = sdsl::rank_support_v<1, 1>>
 class BpSupport;
 
-template<unsigned LEVEL>
+using PlainBpSupport = BpSupport<0, sdsl::bit_vector>;
+using SparseBpSupport = BpSupport<0, sdsl::sd_vector<>>;
+template<uint16_t B = 15>
+using RrrBpSupport = BpSupport<0, sdsl::rrr_vector<B>>;
+
+// Matching parenthesis of every position
+inline sdsl::int_vector<> bp_match_table(const sdsl::bit_vector& bv) {
+  size_t n = bv.size();
+  std::stack<size_t> os;
+  sdsl::int_vector<> fc(n, 0, std::max<uint8_t>(1, sdsl::bits::hi(std::max<size_t>(n, 1)) + 1));
+  for (size_t i = 0; i < n; i++) {
+    if (bv[i]) {
+      os.push(i);
+    } else {
+      fc[os.top()] = i;
+      fc[i] = os.top();
+      os.pop();
+    }
+  }
+  return fc;
+}
+
+inline bool bp_fits_explicit(size_t n, size_t root_size) {
+  auto bits = n * (sdsl::bits::hi(std::max<size_t>(n, 1)) + 1);
+  return bits <= std::max(root_size / kBpExplicitRatio, kBpMinExplicitBits);
+}
+
+template<unsigned LEVEL, typename PioneerBv, typename RankL>
 class BpSupport {
  public:
   using index_type = size_t;
@@ -23,32 +77,73 @@ class BpSupport {
   static constexpr bool kRbra = 0;
   static constexpr unsigned W = 16;
   using bv_type = sdsl::bit_vector;
-  using rankL_type = sdsl::rank_support_v<kLbra, 1>;
-  using r_type = sdsl::rrr_vector<>;
-  using sub_type = BpSupport<LEVEL+1>;
+  using rankL_type = RankL;
+  using pd_rank_type = sdsl::rank_support_v<kLbra, 1>;
+  using r_type = PioneerBv;
+  using sub_type = BpSupport<LEVEL+1, PioneerBv>;
  private:
   bv_type* bvp_;
   rankL_type* rankLp_;
+  bool explicit_;
+  sdsl::int_vector<> fc_; // matches, if the recursion stops here
   r_type r_;
-  r_type::rank_1_type r_rank1_;
-  r_type::select_1_type r_select1_;
+  typename r_type::rank_1_type r_rank1_;
+  typename r_type::select_1_type r_select1_;
   bv_type pd_;
-  rankL_type pd_rank_;
+  pd_rank_type pd_rank_;
+  sdsl::select_support_mcl<kLbra, 1> pd_select_;
   sub_type sub_;
 
+  static constexpr index_type kFar = std::numeric_limits<index_type>::max();
+  // Mate of i if it lies within 16 positions in the word of i, or kFar
+  index_type _near_close(index_type i) const;
+  // Index in pd_ of the last opening pioneer at or before i
+  index_type _pioneer_of(index_type i) const;
+  // Mate of i, given its pioneer and the pioneer's mate as indices in pd_
+  index_type _far_close(index_type i, index_type pred_sub, index_type close_sub) const;
+
  public:
-  BpSupport() = default;
+  BpSupport() : bvp_(nullptr), rankLp_(nullptr), explicit_(false) {}
   explicit BpSupport(bv_type* bvp, rankL_type* rankp) : BpSupport() {
     init_support(bvp, rankp);
   }
 
-  void init_support(bv_type* bvp, rankL_type* ranklp);
+  void init_support(bv_type* bvp, rankL_type* ranklp) {
+    init_support(bvp, ranklp, bvp->size());
+  }
+  void init_support(bv_type* bvp, rankL_type* ranklp, size_t root_size);
+
+  // The levels, without the parentheses and RankL, which load is given.
+  size_t serialize(std::ostream& out) const;
+  void load(std::istream& in, bv_type* bvp, rankL_type* ranklp);
 
   index_type depth(index_type i) const { return (*rankLp_)(i) * 2 - i; }
 
   index_type findclose(index_type i) const;
+  // out[k] = findclose(in[k]) for k < n. Each level resolves a batch of
+  // positions before the next level takes those left, so that the cache
+  // misses of independent positions overlap.
+  void findclose(const index_type* in, size_t n, index_type* out) const;
+
+  bool is_explicit() const { return explicit_; }
+  // Number of levels down to the explicit one
+  unsigned num_levels() const { return is_explicit() ? 1 : 1 + sub_.num_levels(); }
+
+  size_t size_in_bytes() const {
+    if (is_explicit())
+      return sdsl::size_in_bytes(fc_);
+    return sdsl::size_in_bytes(r_) + sdsl::size_in_bytes(r_rank1_) + sdsl::size_in_bytes(r_select1_)
+        + sdsl::size_in_bytes(pd_) + sdsl::size_in_bytes(pd_rank_) + sdsl::size_in_bytes(pd_select_)
+        + sub_.size_in_bytes();
+  }
 
   void print_for_debug() const {
+    if (is_explicit()) {
+      for (int i = 0; i < fc_.size(); i++)
+        std::cout << fc_[i] << ' ';
+      std::cout << std::endl;
+      return;
+    }
     for (int i = 0; i < r_.size(); i++)
       std::cout << r_[i];
     std::cout << std::endl;
@@ -59,14 +154,14 @@ class BpSupport {
   }
 };
 
-template<>
-class BpSupport<2> {
+template<typename PioneerBv, typename RankL>
+class BpSupport<kBpMaxLevel, PioneerBv, RankL> {
  public:
   using index_type = size_t;
   static constexpr bool kLbra = 1;
   static constexpr bool kRbra = 0;
   using bv_type = sdsl::bit_vector;
-  using rankL_type = sdsl::rank_support_v<kLbra, 1>;
+  using rankL_type = RankL;
  private:
   sdsl::int_vector<> fc_;
 
@@ -76,10 +171,31 @@ class BpSupport<2> {
     init_support(bvp, rankp);
   }
 
-  void init_support(bv_type* bvp, rankL_type* ranklp);
+  void init_support(bv_type* bvp, [[maybe_unused]] rankL_type* rankp, size_t = 0) {
+    fc_ = bp_match_table(*bvp);
+    hugepages::advise(fc_);
+  }
+
+  size_t serialize(std::ostream& out) const { return io::write_int_vector(out, fc_); }
+  void load(std::istream& in, bv_type*, rankL_type*) {
+    io::read_int_vector(in, fc_);
+    hugepages::advise(fc_);
+  }
 
   index_type findclose(index_type i) const { return fc_[i]; }
   index_type findopen(index_type i) const { return fc_[i]; }
+  void findclose(const index_type* in, size_t n, index_type* out) const {
+    for (size_t k = 0; k < n; k++) {
+      if (k + kBpPrefetch < n)
+        bp_prefetch(fc_, in[k + kBpPrefetch], fc_.width());
+      out[k] = fc_[in[k]];
+    }
+  }
+
+  bool is_explicit() const { return true; }
+  unsigned num_levels() const { return 1; }
+
+  size_t size_in_bytes() const { return sdsl::size_in_bytes(fc_); }
 
   void print_for_debug() const {
     for (int i = 0; i < fc_.size(); i++)
@@ -88,62 +204,46 @@ class BpSupport<2> {
   }
 };
 
-template<unsigned LEVEL>
-void BpSupport<LEVEL>::init_support(bv_type* bvp, rankL_type* ranklp) {
+template<unsigned LEVEL, typename PioneerBv, typename RankL>
+void BpSupport<LEVEL, PioneerBv, RankL>::init_support(bv_type* bvp, rankL_type* ranklp, size_t root_size) {
   bvp_ = bvp;
   rankLp_ = ranklp;
   index_type n = bvp_->size();
-  std::stack<index_type> os;
+  explicit_ = bp_fits_explicit(n, root_size);
+  if (explicit_) {
+    fc_ = bp_match_table(*bvp_);
+    hugepages::advise(fc_);
+    return;
+  }
+  fc_ = sdsl::int_vector<>();
   // build R, pioneer group
   {
-    std::vector<index_type> p(n);
-    for (size_t i = 0; i < n; i++) {
-      if ((*bvp_)[i] == kLbra) {
-        os.push(i);
-      } else {
-        int j = os.top();
-        p[j] = i;
-        p[i] = j;
-        os.pop();
-      }
-    }
-    assert(os.empty());
+    auto p = bp_match_table(*bvp_);
     auto _r = sdsl::bit_vector(n);
-    os.push(0);
     _r[0] = _r[n-1] = 1;
     auto is_long = [&p](size_t i) { return i/W != p[i]/W; };
+    // A far parenthesis is a pioneer if its mate lies in another block than
+    // the mate of the previous far parenthesis of the same kind.
+    size_t last = 0;
     for (size_t i = 1; i+1 < n; i++) {
-      if (!is_long(i)) continue;
-      if ((*bvp_)[i] == kLbra) {
-        if (p[i]/W != p[os.top()]/W) {
-          _r[i] = _r[p[i]] = 1;
-        }
-        os.push(i);
-      } else {
-        os.pop();
-      }
+      if (!is_long(i) or (*bvp_)[i] != kLbra) continue;
+      if (p[i]/W != p[last]/W)
+        _r[i] = _r[p[i]] = 1;
+      last = i;
     }
-    os.pop();
-    assert(os.empty());
-    os.push(n-1);
-    for (long long i = n-2; i > 0; i--) {
-      if (!is_long(i)) continue;
-      if ((*bvp_)[i] == kRbra) {
-        if (p[i]/W != p[os.top()]/W)
-          _r[i] = _r[p[i]] = 1;
-        os.push(i);
-      } else {
-        os.pop();
-      }
+    last = n-1;
+    for (size_t i = n-2; i > 0; i--) {
+      if (!is_long(i) or (*bvp_)[i] != kRbra) continue;
+      if (p[i]/W != p[last]/W)
+        _r[i] = _r[p[i]] = 1;
+      last = i;
     }
-    os.pop();
-    r_ = sdsl::rrr_vector<>(_r);
+    r_ = r_type(_r);
   }
   sdsl::util::init_support(r_rank1_, &r_);
   sdsl::util::init_support(r_select1_, &r_);
 
   // build find-close
-  assert(os.empty());
   auto num_pioneers = r_rank1_(r_.size());
   pd_ = bv_type(num_pioneers);
   for (size_t i = 0; i < num_pioneers; i++) {
@@ -151,45 +251,131 @@ void BpSupport<LEVEL>::init_support(bv_type* bvp, rankL_type* ranklp) {
     pd_[i] = (*bvp_)[j];
   }
   sdsl::util::init_support(pd_rank_, &pd_);
+  sdsl::util::init_support(pd_select_, &pd_);
 
-  sub_.init_support(&pd_, &pd_rank_);
+  sub_.init_support(&pd_, &pd_rank_, root_size);
 }
 
-void BpSupport<2>::init_support(bv_type* bvp, [[maybe_unused]] rankL_type* rankp) {
-  index_type n = bvp->size();
-  std::stack<index_type> os;
-  fc_ = sdsl::int_vector<>(n);
-  for (size_t i = 0; i < n; i++) {
-    if ((*bvp)[i] == kLbra) {
-      os.push(i);
-    } else {
-      fc_[os.top()] = i;
-      fc_[i] = os.top();
-      os.pop();
-    }
+template<unsigned LEVEL, typename PioneerBv, typename RankL>
+size_t BpSupport<LEVEL, PioneerBv, RankL>::serialize(std::ostream& out) const {
+  size_t bytes = io::write_pod(out, uint8_t(explicit_));
+  if (explicit_)
+    return bytes + io::write_int_vector(out, fc_);
+  bytes += r_.serialize(out);
+  bytes += r_rank1_.serialize(out);
+  bytes += r_select1_.serialize(out);
+  bytes += io::write_int_vector(out, pd_);
+  bytes += pd_rank_.serialize(out);
+  bytes += pd_select_.serialize(out);
+  return bytes + sub_.serialize(out);
+}
+
+template<unsigned LEVEL, typename PioneerBv, typename RankL>
+void BpSupport<LEVEL, PioneerBv, RankL>::load(std::istream& in, bv_type* bvp, rankL_type* ranklp) {
+  bvp_ = bvp;
+  rankLp_ = ranklp;
+  uint8_t e;
+  io::read_pod(in, e);
+  explicit_ = e;
+  if (explicit_) {
+    io::read_int_vector(in, fc_);
+    hugepages::advise(fc_);
+    return;
   }
-  sdsl::util::bit_compress(fc_);
+  fc_ = sdsl::int_vector<>();
+  io::read_support(in, r_);
+  io::read_support(in, r_rank1_, &r_);
+  io::read_support(in, r_select1_, &r_);
+  io::read_int_vector(in, pd_);
+  io::read_support(in, pd_rank_, &pd_);
+  io::read_support(in, pd_select_, &pd_);
+  sub_.load(in, &pd_, &pd_rank_);
 }
 
-template<unsigned LEVEL>
-typename BpSupport<LEVEL>::index_type
-BpSupport<LEVEL>::findclose(index_type i) const {
+template<unsigned LEVEL, typename PioneerBv, typename RankL>
+typename BpSupport<LEVEL, PioneerBv, RankL>::index_type
+BpSupport<LEVEL, PioneerBv, RankL>::_near_close(index_type i) const {
   assert((*bvp_)[i] == kLbra);
   uint64_t w = *(bvp_->data() + (i / 64));
   assert(W == 16);
+  // Past the end of the word, the shift brings in 0s, read as ')' by the table.
   index_type in = findclose16(~(w >> (i % 64)) & 0xFFFF);
-  if (i % 16 + in < 16 and i + in < bvp_->size()) // findclose is in same block of i
+  if (in < W and i % 64 + in < 64 and i + in < bvp_->size())
     return i + in;
+  return kFar;
+}
 
+template<unsigned LEVEL, typename PioneerBv, typename RankL>
+typename BpSupport<LEVEL, PioneerBv, RankL>::index_type
+BpSupport<LEVEL, PioneerBv, RankL>::_pioneer_of(index_type i) const {
+  // The last opening pioneer at or before i shares the block of its mate with i.
   auto pred_sub = r_rank1_(i + 1) - 1;
-  auto pred = r_select1_(pred_sub + 1);
-  auto q = r_select1_(sub_.findclose(pred_sub) + 1);
-  if (i == pred)
+  if (pd_[pred_sub] != kLbra)
+    pred_sub = pd_select_(pd_rank_(pred_sub + 1));
+  return pred_sub;
+}
+
+template<unsigned LEVEL, typename PioneerBv, typename RankL>
+typename BpSupport<LEVEL, PioneerBv, RankL>::index_type
+BpSupport<LEVEL, PioneerBv, RankL>::_far_close(index_type i, index_type pred_sub, index_type close_sub) const {
+  auto q = r_select1_(close_sub + 1);
+  if (i == r_select1_(pred_sub + 1))
     return q;
-  assert(q%16 > 0);
-  auto d = depth(i) - depth(q);
-  auto lead = finddepthr16((w >> (q%64/16*16)) << (15-q%16) & 0xFFFF, d);
-  return q - 1 - lead;
+  // The mate of i is the first position in the block of q closing down to depth of i.
+  auto d = depth(i);
+  auto x = q / W * W;
+  auto e = depth(x);
+  uint64_t qw = *(bvp_->data() + (x / 64));
+  for (; ; x++) {
+    assert(x <= q);
+    e += ((qw >> (x % 64)) & 1) ? 1 : -1;
+    if (e == d)
+      return x;
+  }
+}
+
+template<unsigned LEVEL, typename PioneerBv, typename RankL>
+typename BpSupport<LEVEL, PioneerBv, RankL>::index_type
+BpSupport<LEVEL, PioneerBv, RankL>::findclose(index_type i) const {
+  auto c = _near_close(i);
+  if (c != kFar)
+    return c;
+  if (is_explicit())
+    return fc_[i];
+  auto pred_sub = _pioneer_of(i);
+  return _far_close(i, pred_sub, sub_.findclose(pred_sub));
+}
+
+template<unsigned LEVEL, typename PioneerBv, typename RankL>
+void BpSupport<LEVEL, PioneerBv, RankL>::findclose(const index_type* in, size_t n, index_type* out) const {
+  for (; n > kBpBatch; in += kBpBatch, out += kBpBatch, n -= kBpBatch)
+    findclose(in, kBpBatch, out);
+
+  // Positions of the batch whose mates are far, and their pioneers in pd_
+  index_type far[kBpBatch], pred_sub[kBpBatch], close_sub[kBpBatch];
+  size_t m = 0;
+  for (size_t k = 0; k < n; k++) {
+    if (k + kBpPrefetch < n)
+      bp_prefetch(*bvp_, in[k + kBpPrefetch]);
+    out[k] = _near_close(in[k]);
+    if (out[k] == kFar)
+      far[m++] = k;
+  }
+  if (m == 0)
+    return;
+  if (is_explicit()) {
+    for (size_t j = 0; j < m; j++) {
+      if (j + kBpPrefetch < m)
+        bp_prefetch(fc_, in[far[j + kBpPrefetch]], fc_.width());
+      out[far[j]] = fc_[in[far[j]]];
+    }
+    return;
+  }
+  for (size_t j = 0; j < m; j++)
+    pred_sub[j] = _pioneer_of(in[far[j]]);
+  sub_.findclose(pred_sub, m, close_sub);
+  for (size_t j = 0; j < m; j++)
+    out[far[j]] = _far_close(in[far[j]], pred_sub[j], close_sub[j]);
 }
 
 
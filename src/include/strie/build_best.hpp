@@ -0,0 +1,244 @@
+#ifndef SUCCINCT_TRIES__BUILD_BEST_HPP_
+#define SUCCINCT_TRIES__BUILD_BEST_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <iterator>
+#include <type_traits>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+#include <ostream>
+
+#include "centroid_path_tree.hpp"
+#include "dfuds.hpp"
+#include "image.hpp"
+#include "key.hpp"
+#include "louds.hpp"
+
+namespace strie {
+
+// Shape of a sorted key set, from a sample of it
+struct KeySetStats {
+  static constexpr size_t kFanoutBuckets = 9;
+
+  size_t num_keys = 0;
+  size_t sample_keys = 0;
+  double avg_length = 0;
+  double nodes_per_key = 0;        // trie nodes per key (count_trie_nodes)
+  double shared_prefix_ratio = 0;  // mean of lcp with the previous key / length
+  double unary_ratio = 0;          // internal nodes with one child
+  double avg_fanout = 0;           // children per internal node
+  // Share of internal nodes with 1, 2, 3-4, 5-8, ..., 129-256 children
+  std::array<double, kFanoutBuckets> fanout_histogram{};
+  // Per key, over the nodes on its path: labels a sibling scan reads,
+  // (children + 1) / 2 per node, and nodes with two children or more
+  double scanned_labels = 0;
+  double branching_nodes = 0;
+};
+
+// Stats of sorted keys [begin, end) from blocks of kBlock consecutive keys
+// evenly spread over the set, sample_size keys in all. Lengths, nodes and
+// shared prefixes compare each sampled key with its true predecessor;
+// fanouts are those of the trie of the sample, which misses branches
+// between blocks below their first bytes.
+template<typename It>
+KeySetStats key_set_stats(It begin, It end, size_t sample_size = 1u << 14);
+
+enum class Objective { kSpace, kLatency };
+
+struct Estimate {
+  image::Type type;
+  double bytes;  // in memory, with rank/select and BpSupport
+  double ns;     // per lookup
+};
+
+// Size and lookup cost of Louds, DfudsTrie and CentroidPathTree.
+// Sizes are linear in nodes and keys, as measured on strie::datasets at 200K
+// keys, where the parent offsets and key ranks of CentroidPathTree take 43
+// bits. Lookup costs are fitted to perf_bench-style runs of the datasets at
+// 20K and 200K keys: Louds pays a select per byte, cheaper on shared prefixes
+// whose levels stay in cache, and scans sibling labels; DfudsTrie pays a
+// findclose per byte, slow at branching nodes whose subtrees are large;
+// CentroidPathTree pays per branch off a centroid path. They rank the
+// structures, not predict times on other hosts.
+inline std::array<Estimate, 3> estimate(const KeySetStats& s) {
+  double keys = std::max<size_t>(s.num_keys, 1);
+  double nodes = s.nodes_per_key * keys;
+  double cold = s.avg_length * (1 - s.shared_prefix_ratio);
+  double hot = s.avg_length * s.shared_prefix_ratio;
+  double extra_scan = std::max(0.0, s.scanned_labels - s.avg_length);
+  // Labels of CentroidPathTree are std::strings, on the heap past 15 bytes.
+  double label_heap = s.nodes_per_key - 1 > 15 ? 16 : 0;
+  return {{
+      {image::Type::kLouds, 2.50 * nodes, 300 * cold + 120 * hot + 4 * extra_scan},
+      {image::Type::kDfuds, 2.75 * nodes, 280 * cold + 150 * hot + 4300 * s.branching_nodes},
+      {image::Type::kCentroidPathTree, (42.0 + label_heap) * keys + 0.88 * nodes,
+       5000 + 1600 * s.branching_nodes},
+  }};
+}
+
+inline Estimate choose(const KeySetStats& s, Objective objective) {
+  auto es = estimate(s);
+  return *std::min_element(es.begin(), es.end(), [&](auto& a, auto& b) {
+    return objective == Objective::kSpace ? a.bytes < b.bytes : a.ns < b.ns;
+  });
+}
+
+// A trie of any of the structures
+class AnyTrie {
+  struct Concept {
+    virtual ~Concept() = default;
+    virtual bool contains(std::string_view key) const = 0;
+    virtual size_t size() const = 0;
+    virtual size_t save(std::ostream& out, image::Supports supports) const = 0;
+  };
+  template<typename T>
+  struct Model final : Concept {
+    T trie;
+    template<typename It>
+    Model(It begin, It end) : trie(begin, end) {}
+    bool contains(std::string_view key) const override { return trie.contains(key); }
+    size_t size() const override { return trie.size(); }
+    size_t save(std::ostream& out, image::Supports supports) const override {
+      return image::save(trie, out, supports);
+    }
+  };
+
+  image::Type type_;
+  std::unique_ptr<Concept> p_;
+
+  AnyTrie(image::Type type, std::unique_ptr<Concept> p) : type_(type), p_(std::move(p)) {}
+
+ public:
+  template<typename T, typename It>
+  static AnyTrie make(image::Type type, It begin, It end) {
+    return AnyTrie(type, std::make_unique<Model<T>>(begin, end));
+  }
+
+  image::Type type() const { return type_; }
+  const char* name() const { return image::type_name(type_); }
+  size_t size() const { return p_->size(); }
+  bool empty() const { return size() == 0; }
+
+  bool contains(std::string_view key) const { return p_->contains(key); }
+  bool contains(const std::string& key) const { return contains(std::string_view(key)); }
+  bool contains(const char* key) const { return contains(std::string_view(key)); }
+
+  // The trie if it is a T, or nullptr
+  template<typename T>
+  const T* get() const {
+    auto m = dynamic_cast<const Model<T>*>(p_.get());
+    return m ? &m->trie : nullptr;
+  }
+
+  size_t save(std::ostream& out, image::Supports supports = image::Supports::kRebuild) const {
+    return p_->save(out, supports);
+  }
+};
+
+// The structure of least estimated size or lookup cost for sorted keys
+// [begin, end), built on them.
+template<typename It>
+AnyTrie build_best(It begin, It end, Objective objective = Objective::kLatency) {
+  switch (choose(key_set_stats(begin, end), objective).type) {
+    case image::Type::kLouds:
+      return AnyTrie::make<Louds>(image::Type::kLouds, begin, end);
+    case image::Type::kDfuds:
+      return AnyTrie::make<DfudsTrie>(image::Type::kDfuds, begin, end);
+    case image::Type::kCentroidPathTree:
+      break;
+  }
+  return AnyTrie::make<CentroidPathTree>(image::Type::kCentroidPathTree, begin, end);
+}
+
+template<typename It>
+KeySetStats key_set_stats(It begin, It end, size_t sample_size) {
+  using traits = std::iterator_traits<It>;
+  static_assert(is_key_v<typename traits::value_type>);
+  constexpr size_t kBlock = 16;
+
+  KeySetStats s;
+  s.num_keys = std::distance(begin, end);
+  if (s.num_keys == 0)
+    return s;
+  auto num_blocks = std::max<size_t>(1, sample_size / kBlock);
+  auto in_sample = [&](size_t i) {
+    if (s.num_keys <= sample_size)
+      return true;
+    auto b = i * num_blocks / s.num_keys; // block whose range starts at or before i
+    return i < b * s.num_keys / num_blocks + kBlock;
+  };
+
+  // Nodes on the path of the last sampled key: children, and keys below
+  struct PathNode { size_t children, keys; };
+  std::vector<PathNode> path = {{0, 0}};
+  size_t internal = 0, unary = 0, children = 0, length = 0, new_nodes = 0;
+  double shared = 0, scanned = 0, branching = 0;
+  auto pop = [&] {
+    auto [c, k] = path.back();
+    path.pop_back();
+    if (!path.empty())
+      path.back().keys += k;
+    if (c > 0) {
+      internal++;
+      children += c;
+      unary += c == 1;
+      size_t b = 0;
+      while ((size_t(1) << b) < c and b + 1 < KeySetStats::kFanoutBuckets)
+        b++;
+      s.fanout_histogram[b]++;
+    }
+    scanned += k * (c + 1) / 2.0;
+    branching += k * (c >= 2);
+  };
+
+  auto lcp = [](std::string_view a, std::string_view b) -> size_t {
+    auto n = std::min(a.size(), b.size());
+    return std::mismatch(a.begin(), a.begin() + n, b.begin()).first - a.begin();
+  };
+  std::string_view pred, sample_pred;
+  size_t i = 0;
+  for (auto it = begin; it != end; ++it, ++i) {
+    auto key = key_view(*it);
+    if (in_sample(i)) {
+      s.sample_keys++;
+      length += key.size();
+      auto l = lcp(pred, key);
+      new_nodes += key.size() - l;
+      shared += key.empty() ? 0 : double(l) / key.size();
+
+      auto sl = lcp(sample_pred, key);
+      while (path.size() > sl + 1)
+        pop();
+      if (key.size() > sl)
+        path.back().children++;
+      for (auto d = sl + 1; d <= key.size(); d++)
+        path.push_back({d < key.size() ? 1u : 0u, 0});
+      path.back().keys++;
+      sample_pred = key;
+    }
+    pred = key;
+  }
+  while (!path.empty())
+    pop();
+
+  double m = s.sample_keys;
+  s.avg_length = length / m;
+  s.nodes_per_key = (new_nodes + 1) / m;
+  s.shared_prefix_ratio = shared / m;
+  s.unary_ratio = internal ? double(unary) / internal : 0;
+  s.avg_fanout = internal ? double(children) / internal : 0;
+  for (auto& h : s.fanout_histogram)
+    h = internal ? h / internal : 0;
+  s.scanned_labels = scanned / m;
+  s.branching_nodes = branching / m;
+  return s;
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__BUILD_BEST_HPP_
@@ -0,0 +1,85 @@
+#ifndef SUCCINCT_TRIES__BUILD_STATS_HPP_
+#define SUCCINCT_TRIES__BUILD_STATS_HPP_
+
+#include <cstddef>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+
+#include <sys/resource.h>
+
+#include "key.hpp"
+
+namespace strie {
+
+// Time and memory of each phase of the last build of a trie.
+struct BuildStats {
+  struct Phase {
+    std::string name;
+    double seconds;
+    size_t bytes;     // size of what the phase built, 0 if none
+    size_t peak_rss;  // process high-water mark at the end of the phase
+  };
+  std::vector<Phase> phases;
+  size_t num_nodes = 0;
+
+  void start() {
+    phases.clear();
+    num_nodes = 0;
+    last_ = std::chrono::steady_clock::now();
+  }
+
+  void mark(std::string name, size_t bytes = 0) {
+    auto now = std::chrono::steady_clock::now();
+    phases.push_back({std::move(name), std::chrono::duration<double>(now - last_).count(),
+                      bytes, peak_rss_bytes()});
+    last_ = now;
+  }
+
+  double seconds() const {
+    double s = 0;
+    for (auto& p : phases)
+      s += p.seconds;
+    return s;
+  }
+
+  static size_t peak_rss_bytes() {
+    rusage ru;
+    return getrusage(RUSAGE_SELF, &ru) == 0 ? size_t(ru.ru_maxrss) * 1024 : 0;
+  }
+
+  void print(std::ostream& os = std::cout) const {
+    os << "phase\tseconds\tMB\tpeak RSS MB" << std::endl;
+    for (auto& p : phases)
+      os << p.name << '\t' << std::fixed << std::setprecision(3) << p.seconds << '\t'
+         << p.bytes / 1e6 << '\t' << p.peak_rss / 1e6 << std::endl;
+    os << "total\t" << seconds() << "\t\t(" << num_nodes << " nodes)" << std::endl;
+  }
+
+ private:
+  std::chrono::steady_clock::time_point last_ = std::chrono::steady_clock::now();
+};
+
+// Number of nodes of the trie of sorted keys [begin, end): the root and one
+// per distinct nonempty prefix.
+template<typename It>
+size_t count_trie_nodes(It begin, It end) {
+  size_t n = 1;
+  std::string_view pre;
+  for (auto it = begin; it != end; ++it) {
+    auto key = key_view(*it);
+    size_t l = 0, m = std::min(pre.size(), key.size());
+    while (l < m and pre[l] == key[l])
+      l++;
+    n += key.size() - l;
+    pre = key;
+  }
+  return n;
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__BUILD_STATS_HPP_
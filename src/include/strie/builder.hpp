@@ -0,0 +1,177 @@
+#ifndef SUCCINCT_TRIES__BUILDER_HPP_
+#define SUCCINCT_TRIES__BUILDER_HPP_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <iterator>
+#include <type_traits>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "key.hpp"
+
+namespace strie {
+
+// Sorts views of keys by MSD radix sort on their first bytes, then by
+// comparison, in the byte order of std::string.
+// Buckets of the first byte are sorted in parallel.
+class KeySorter {
+ public:
+  using key_type = std::string_view;
+ private:
+  static constexpr size_t kSigma = 257; // end of key, then bytes
+  static constexpr size_t kSmall = 32;
+  // Past kDeep bytes, keys are compared by memcmp instead, which passes long
+  // shared prefixes faster than a count per byte.
+  static constexpr size_t kDeep = 16;
+
+  static size_t _code(key_type s, size_t d) {
+    return d < s.size() ? (unsigned char) s[d] + 1 : 0;
+  }
+
+  static void _insertion_sort(key_type* a, size_t n, size_t d) {
+    for (size_t i = 1; i < n; i++) {
+      auto x = a[i];
+      auto xs = x.substr(d);
+      size_t j = i;
+      for (; j > 0 and xs < a[j-1].substr(d); j--)
+        a[j] = a[j-1];
+      a[j] = x;
+    }
+  }
+
+  // Sort a[0..n), all sharing their first d bytes, using tmp[0..n).
+  static void _sort(key_type* a, key_type* tmp, size_t n, size_t d);
+
+ public:
+  static void sort(std::vector<key_type>& keys,
+                   unsigned num_threads = std::max(1u, std::thread::hardware_concurrency()));
+};
+
+inline void KeySorter::_sort(key_type* a, key_type* tmp, size_t n, size_t d) {
+  std::array<size_t, kSigma + 1> cnt;
+  while (n >= kSmall and d < kDeep) {
+    cnt.fill(0);
+    for (size_t i = 0; i < n; i++)
+      ++cnt[_code(a[i], d) + 1];
+    // Skip a byte all keys share without moving them.
+    if (std::find(cnt.begin() + 1, cnt.end(), n) != cnt.end() and cnt[1] != n) {
+      ++d;
+      continue;
+    }
+    for (size_t c = 0; c < kSigma; c++)
+      cnt[c+1] += cnt[c];
+    auto pos = cnt;
+    for (size_t i = 0; i < n; i++)
+      tmp[pos[_code(a[i], d)]++] = a[i];
+    std::copy(tmp, tmp + n, a);
+    // Keys ended at d are equal. Recurse into the other buckets but the
+    // largest, and go on with it here, so that recursion is O(log n) deep
+    // even on chains of prefixes.
+    size_t big = 1;
+    for (size_t c = 2; c < kSigma; c++)
+      if (cnt[c+1] - cnt[c] > cnt[big+1] - cnt[big])
+        big = c;
+    for (size_t c = 1; c < kSigma; c++)
+      if (c != big and cnt[c+1] - cnt[c] > 1)
+        _sort(a + cnt[c], tmp + cnt[c], cnt[c+1] - cnt[c], d + 1);
+    a += cnt[big];
+    tmp += cnt[big];
+    n = cnt[big+1] - cnt[big];
+    ++d;
+  }
+  if (n < kSmall)
+    _insertion_sort(a, n, d);
+  else
+    std::sort(a, a + n, [d](auto l, auto r) { return l.substr(d) < r.substr(d); });
+}
+
+inline void KeySorter::sort(std::vector<key_type>& keys, unsigned num_threads) {
+  auto n = keys.size();
+  num_threads = std::max(1u, num_threads);
+  std::vector<key_type> tmp(n);
+  if (num_threads == 1 or n < (1u << 16)) {
+    _sort(keys.data(), tmp.data(), n, 0);
+    return;
+  }
+  // Distribute by the first byte, each thread counting and moving its chunk.
+  std::vector<std::array<size_t, kSigma>> cnts(num_threads);
+  auto chunk = (n + num_threads - 1) / num_threads;
+  auto parallel = [num_threads](auto&& fn) {
+    std::vector<std::thread> ths;
+    for (unsigned t = 0; t < num_threads; t++)
+      ths.emplace_back(fn, t);
+    for (auto& th : ths)
+      th.join();
+  };
+  parallel([&](unsigned t) {
+    cnts[t].fill(0);
+    for (auto i = t * chunk; i < std::min(n, (t+1) * chunk); i++)
+      ++cnts[t][_code(keys[i], 0)];
+  });
+  std::array<size_t, kSigma + 1> bucket{};
+  size_t sum = 0;
+  for (size_t c = 0; c < kSigma; c++) {
+    bucket[c] = sum;
+    for (auto& cnt : cnts) {
+      auto x = cnt[c];
+      cnt[c] = sum;
+      sum += x;
+    }
+  }
+  bucket[kSigma] = n;
+  parallel([&](unsigned t) {
+    for (auto i = t * chunk; i < std::min(n, (t+1) * chunk); i++)
+      tmp[cnts[t][_code(keys[i], 0)]++] = keys[i];
+  });
+  keys.swap(tmp);
+  // Sort buckets, largest first.
+  std::vector<size_t> order;
+  for (size_t c = 1; c < kSigma; c++)
+    if (bucket[c+1] - bucket[c] > 1)
+      order.push_back(c);
+  std::sort(order.begin(), order.end(), [&](auto l, auto r) {
+    return bucket[l+1] - bucket[l] > bucket[r+1] - bucket[r];
+  });
+  std::atomic<size_t> next = 0;
+  parallel([&](unsigned) {
+    for (size_t j; (j = next++) < order.size(); ) {
+      auto c = order[j];
+      _sort(keys.data() + bucket[c], tmp.data() + bucket[c], bucket[c+1] - bucket[c], 1);
+    }
+  });
+}
+
+// Views of the keys in [begin, end), sorted and without duplicates.
+// The keys must outlive the views.
+template<typename It>
+std::vector<std::string_view> sorted_unique_views(
+    It begin, It end, unsigned num_threads = std::max(1u, std::thread::hardware_concurrency())) {
+  using traits = std::iterator_traits<It>;
+  static_assert(is_key_v<typename traits::value_type>);
+  std::vector<std::string_view> views;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename traits::iterator_category>)
+    views.reserve(std::distance(begin, end));
+  for (auto it = begin; it != end; ++it)
+    views.push_back(key_view(*it));
+  KeySorter::sort(views, num_threads);
+  views.erase(std::unique(views.begin(), views.end()), views.end());
+  return views;
+}
+
+// Build a trie T (Louds, DfudsTrie, CentroidPathTree, DoubleArrayTrie, ...)
+// from keys in any order, with duplicates.
+template<typename T, typename It>
+T build_unsorted(It begin, It end,
+                 unsigned num_threads = std::max(1u, std::thread::hardware_concurrency())) {
+  auto views = sorted_unique_views(begin, end, num_threads);
+  return T(views.begin(), views.end());
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__BUILDER_HPP_
@@ -2,14 +2,32 @@
 #define SUCCINCT_TRIES__CENTROID_PATH_TREE_HPP_
 
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <string_view>
 #include <algorithm>
+#include <numeric>
+#include <optional>
+#include <iterator>
+#include <limits>
+#include <map>
 #include <utility>
 #include <vector>
 
+#include "dfuds.hpp"
+#include "image.hpp"
+#include "io.hpp"
+#include "key.hpp"
+#include "permutation.hpp"
+
 namespace strie {
 
-class CentroidPathTreeRaw {
+// Centroid path decomposition of sorted keys, with a Label per path:
+// std::string owns the labels; std::string_view points into the keys, which
+// must then outlive the tree, as in CentroidPathTree::build.
+template<typename Label = std::string>
+class BasicCentroidPathTreeRaw {
  public:
   using index_type = size_t;
   using char_type = char;
@@ -17,21 +35,26 @@ class CentroidPathTreeRaw {
   using value_type = std::string;
  private:
   struct Node {
-    std::string l;
+    Label l;
     std::map<std::pair<index_type, char_type>, index_type> ch;
     size_t sz;
+    index_type rank;  // of the key the path ends at, in sorted order
     Node() = default;
-    Node(std::string&& l) : l(l), sz(1) {}
+    Node(std::string_view l, index_type rank) : l(l), sz(1), rank(rank) {}
   };
   std::vector<Node> nodes_;
   friend class CentroidPathTree;
 
  public:
-  CentroidPathTreeRaw() {}
+  BasicCentroidPathTreeRaw() {}
   template<typename It>
-  CentroidPathTreeRaw(It begin, It end) : CentroidPathTreeRaw() {
+  BasicCentroidPathTreeRaw(It begin, It end) : BasicCentroidPathTreeRaw() {
     build(begin, end);
   }
+  template<typename It, typename WeightIt>
+  BasicCentroidPathTreeRaw(It begin, It end, WeightIt weights) : BasicCentroidPathTreeRaw() {
+    build(begin, end, weights);
+  }
 
  private:
   template<typename It>
@@ -40,59 +63,31 @@ class CentroidPathTreeRaw {
     if (begin == end)
       return;
     for (auto pre = begin, it = std::next(begin); it != end; ++pre, ++it)
-      if (not (*pre < *it))
+      if (not (key_view(*pre) < key_view(*it)))
         throw std::domain_error("Input string collection is not sorted.");
   }
 
+  // ws[i] is the total weight of the first i keys.
+  template<typename It>
+  void _build(It begin, It end, const std::vector<double>& ws);
+
  public:
+  // The heavy path follows the child holding the most keys.
   template<typename It>
   void build(It begin, It end) {
-    using traits = std::iterator_traits<It>;
-    static_assert(std::is_convertible_v<typename traits::value_type, value_type>);
-    static_assert(std::is_base_of_v<std::forward_iterator_tag, typename traits::iterator_category>);
-    _check_valid_input(begin, end);
-
-    auto construct = [&](auto& f, It b, It e, size_t top, size_t dep) -> index_type {
-      assert(b != e);
-      if (next(b) == e) {
-        auto id = nodes_.size();
-        nodes_.emplace_back(b->substr(top));
-        return id;
-      }
-      auto it = b;
-      std::vector<std::tuple<size_t, It, It, char_type>> chs;
-      if (it->length() == dep) {
-        chs.emplace_back(1, it, next(it), kEndLabel);
-        ++it;
-      }
-      assert(it->length() > dep);
-      while (it != e) {
-        auto t = it;
-        auto c = (*t)[dep];
-        ++t;
-        size_t sz = 1;
-        while (t != e and (*t)[dep] == c) {
-          ++t;
-          ++sz;
-        }
-        chs.emplace_back(sz, it, t, c);
-        it = t;
-      }
-      std::vector<size_t> I(chs.size());
-      std::iota(I.begin(), I.end(), 0ll);
-      std::sort(I.begin(), I.end(), [&chs](auto& l, auto& r) {
-        return std::get<0>(chs[l]) > std::get<0>(chs[r]);
-      });
-      auto par = f(f, std::get<1>(chs[I[0]]), std::get<2>(chs[I[0]]), top, dep+1);
-      for (size_t i = 1; i < I.size(); i++) {
-        auto [sz,cb,ce,c] = chs[I[i]];
-        auto cid = f(f, cb, ce, dep, dep+1);
-        nodes_[par].ch[{dep-top, c}] = cid;
-        nodes_[par].sz += nodes_[cid].sz;
-      }
-      return par;
-    };
-    construct(construct, begin, end, 0, 0);
+    std::vector<double> ws(std::distance(begin, end) + 1);
+    std::iota(ws.begin(), ws.end(), 0.0);
+    _build(begin, end, ws);
+  }
+
+  // The heavy path follows the child of the largest total weight, e.g. the
+  // access frequency of its keys, so that frequent keys take few branches.
+  template<typename It, typename WeightIt>
+  void build(It begin, It end, WeightIt weights) {
+    std::vector<double> ws = {0};
+    for (auto it = begin; it != end; ++it, ++weights)
+      ws.push_back(ws.back() + *weights);
+    _build(begin, end, ws);
   }
 
   template<typename STR>
@@ -119,6 +114,70 @@ class CentroidPathTreeRaw {
 
 };
 
+template<typename Label>
+template<typename It>
+void BasicCentroidPathTreeRaw<Label>::_build(It begin, It end, const std::vector<double>& ws) {
+  using traits = std::iterator_traits<It>;
+  static_assert(is_key_v<typename traits::value_type>);
+  static_assert(std::is_base_of_v<std::forward_iterator_tag, typename traits::iterator_category>);
+  _check_valid_input(begin, end);
+
+  nodes_.clear();
+  auto construct = [&](auto& f, It b, It e, size_t o, size_t top, size_t dep) -> index_type {
+    assert(b != e);
+    if (next(b) == e) {
+      auto id = nodes_.size();
+      nodes_.emplace_back(key_view(*b).substr(top), o);
+      return id;
+    }
+    auto it = b;
+    std::vector<std::tuple<double, It, It, size_t, char_type>> chs;
+    if (key_view(*it).length() == dep) {
+      chs.emplace_back(ws[o+1] - ws[o], it, next(it), o, kEndLabel);
+      ++it;
+      ++o;
+    }
+    assert(key_view(*it).length() > dep);
+    while (it != e) {
+      auto t = it;
+      auto c = key_view(*t)[dep];
+      ++t;
+      size_t sz = 1;
+      while (t != e and key_view(*t)[dep] == c) {
+        ++t;
+        ++sz;
+      }
+      chs.emplace_back(ws[o+sz] - ws[o], it, t, o, c);
+      it = t;
+      o += sz;
+    }
+    std::vector<size_t> I(chs.size());
+    std::iota(I.begin(), I.end(), 0ll);
+    std::stable_sort(I.begin(), I.end(), [&chs](auto& l, auto& r) {
+      return std::get<0>(chs[l]) > std::get<0>(chs[r]);
+    });
+    auto [hw,hb,he,ho,hc] = chs[I[0]];
+    auto par = f(f, hb, he, ho, top, dep+1);
+    for (size_t i = 1; i < I.size(); i++) {
+      auto [w,cb,ce,co,c] = chs[I[i]];
+      index_type cid;
+      if (c == kEndLabel and key_view(*cb).length() == dep) {
+        // The key ending here; its label is the end label alone.
+        cid = nodes_.size();
+        nodes_.emplace_back(std::string_view(&kEndLabel, 1), co);
+      } else {
+        cid = f(f, cb, ce, co, dep, dep+1);
+      }
+      nodes_[par].ch[{dep-top, c}] = cid;
+      nodes_[par].sz += nodes_[cid].sz;
+    }
+    return par;
+  };
+  construct(construct, begin, end, 0, 0, 0);
+}
+
+using CentroidPathTreeRaw = BasicCentroidPathTreeRaw<>;
+
 
 class CentroidPathTree : protected Dfuds {
   using dfuds = Dfuds;
@@ -133,125 +192,165 @@ class CentroidPathTree : protected Dfuds {
   sdsl::bit_vector bl_, bs_;
   sdsl::bit_vector::rank_1_type bl_rank1_;
   sdsl::bit_vector::select_1_type bl_select1_;
-  std::vector<char_type> cs_;
+  hugepage_vector<char_type> cs_;
   sdsl::int_vector<> is_;
+  // up_[id] is the '(' of node id in its parent, so access walks up
+  // without findclose.
+  sdsl::int_vector<> up_;
+  // rank_[id] is the rank of the key of node id among the sorted keys. Short
+  // cycle shortcuts keep the inverse of access near the cost of its decode.
+  Permutation<4> rank_;
 
-  void orchestrate() {
-    dfuds::orchestrate();
-    sdsl::util::init_support(bl_rank1_, &bl_);
-    sdsl::util::init_support(bl_select1_, &bl_);
+  void orchestrate(image::Reader* r = nullptr) {
+    dfuds::orchestrate(r);
+    if (r and r->stores_supports(image::rank_select_id_v<DefaultRankSelect>)) {
+      r->section("bl_rank1", [&](std::istream& in) { io::read_support(in, bl_rank1_, &bl_); });
+      r->section("bl_select1", [&](std::istream& in) { io::read_support(in, bl_select1_, &bl_); });
+    } else {
+      sdsl::util::init_support(bl_rank1_, &bl_);
+      sdsl::util::init_support(bl_select1_, &bl_);
+    }
     sdsl::util::bit_compress(is_);
+    sdsl::util::bit_compress(up_);
+    stats_.mark("branch_supports", sdsl::size_in_bytes(bl_rank1_) + sdsl::size_in_bytes(bl_select1_)
+                                   + sdsl::size_in_bytes(is_) + sdsl::size_in_bytes(up_)
+                                   + rank_.size_in_bytes());
   }
 
+  template<typename Label>
+  void _build(const BasicCentroidPathTreeRaw<Label>& raw);
+
  public:
   CentroidPathTree() {}
   template<typename It>
   CentroidPathTree(It begin, It end) : CentroidPathTree() {
     build(begin, end);
   }
+  template<typename It, typename WeightIt>
+  CentroidPathTree(It begin, It end, WeightIt weights) : CentroidPathTree() {
+    build(begin, end, weights);
+  }
 
   void build(const CentroidPathTreeRaw& raw) {
-    dfuds::bv_ = decltype(bv_)();
-    bl_ = decltype(bl_)();
-    bs_ = decltype(bs_)();
-    cs_ = decltype(cs_)();
-    is_ = decltype(is_)();
-    auto expand = [&](size_t additional) {
-      auto newsize = dfuds::bv_.size() + additional;
-      dfuds::bv_.resize(newsize);
-      bl_.resize(newsize);
-      bs_.resize(newsize);
-      cs_.resize(newsize);
-    };
-    expand(1);
-    dfuds::bv_[0] = kLbra;
-    cs_[0] = kDelim;
-    auto dfs = [&](auto& f, index_type id) -> void {
-      const auto& node = raw.nodes_[id];
-      labels_.push_back(node.l.substr(id == 0 ? 0 : 1));
-      auto off = bv_.size();
-      expand(node.ch.size() + 1);
-      size_t k = 0;
-      if (!node.ch.empty()) {
-        index_type pidx = -1;
-        for (auto& [key, nxt] : node.ch) {
-          auto& [idx,c] = key;
-          dfuds::bv_[off+k] = kLbra;
-          if (idx != pidx) {
-            pidx = idx;
-            is_.resize(is_.size()+1);
-            assert(id == 0 or idx > 0);
-            is_[is_.size()-1] = idx - (id == 0 ? 0 : 1);
-            if (k > 0)
-              bl_[off+k-1] = 1;
-          }
-          bs_[off+k] = node.l[idx] < c;
-          cs_[off+k] = c;
-          ++k;
-        }
-        bl_[off+k-1] = 1;
-      }
-      dfuds::bv_[off+k] = kRbra;
-      cs_[off+k] = kDelim;
-
-      for (auto& [key, nxt] : node.ch)
-        f(f, nxt);
-    };
-    dfs(dfs, 0);
-
-    orchestrate();
+    stats_.start();
+    _build(raw);
   }
+  // The decomposition of a build keeps views into the keys until it ends.
   template<typename It>
   void build(It begin, It end) {
-    build(CentroidPathTreeRaw(begin, end));
+    stats_.start();
+    BasicCentroidPathTreeRaw<std::string_view> raw(begin, end);
+    stats_.mark("decompose");
+    _build(raw);
   }
+  // Decompose by per-key weights; see CentroidPathTreeRaw::build.
+  template<typename It, typename WeightIt>
+  void build(It begin, It end, WeightIt weights) {
+    stats_.start();
+    BasicCentroidPathTreeRaw<std::string_view> raw(begin, end, weights);
+    stats_.mark("decompose");
+    _build(raw);
+  }
+
+  using dfuds::build_stats;
 
  private:
   static constexpr index_type INVALID = std::numeric_limits<index_type>::max();
 
+  // Nodes with more branching offsets than this search is_ by bisection.
+  static constexpr index_type kLinearBranches = 16;
+
+  // First 1 of bl_ at or after i, found by tzcnt in the words holding i and
+  // the next one, and by bl_select1_ otherwise.
+  index_type _next_branch_end(index_type i) const {
+    auto data = bl_.data();
+    uint64_t w = data[i / 64] >> (i % 64);
+    if (w != 0)
+      return i + __builtin_ctzll(w);
+    auto j = i / 64 + 1;
+    if (j < (bl_.size() + 63) / 64 and (w = data[j]) != 0)
+      return j * 64 + __builtin_ctzll(w);
+    return bl_select1_(bl_rank1_(i) + 1);
+  }
+
   // Transition by index-of-label and head-label
   index_type go(index_type idx, size_t t, char_type c) const {
-    index_type r = bl_rank1_(idx), b = 0, f;
+    index_type r = bl_rank1_(idx), b;
     index_type bdeg = bl_rank1_(idx + dfuds::degree(idx)) - r;
-    while (b < bdeg and (f = is_[r+b]) < t) {
-      ++b;
-    }
-    if (b == bdeg or f > t)
-      return INVALID;
-    assert(f == t);
-    index_type i = b == 0 ? 0 : bl_select1_(r+b)+1 - idx;
-    while (cs_[idx+i] != c) {
-      if (bl_[idx+i])
+    if (bdeg <= kLinearBranches) {
+      index_type f;
+      for (b = 0; b < bdeg and (f = is_[r+b]) < t; )
+        ++b;
+      if (b == bdeg or f > t)
+        return INVALID;
+    } else {
+      auto first = is_.begin() + r;
+      auto it = std::lower_bound(first, first + bdeg, t);
+      b = it - first;
+      if (b == bdeg or *it != t)
         return INVALID;
-      ++i;
     }
-    return dfuds::child(idx, i);
+    // Labels branching at t lie in cs_[idx+i..idx+e].
+    index_type i = b == 0 ? 0 : bl_select1_(r+b)+1 - idx;
+    index_type e = _next_branch_end(idx + i) - idx;
+    auto p = static_cast<const char_type*>(std::memchr(cs_.data() + idx + i, c, e - i + 1));
+    if (p == nullptr)
+      return INVALID;
+    return dfuds::child(idx, p - (cs_.data() + idx));
   };
 
- public:
+  // Node of the key, or INVALID
   template<typename STR>
-  bool contains(const STR& key) const {
+  index_type _find(const STR& key) const {
+    if (labels_.empty())
+      return INVALID;
     index_type idx = 1;
     size_t k = 0;
-    while (k < key.length()) {
+    while (true) {
       auto& l = labels_[rankR(idx)];
       size_t len = std::min(l.length(), key.length()-k);
       size_t t = 0;
       while (t < len and l[t] == key[k+t])
         ++t;
-      if (k+t == key.length()) {
-        if (t == l.length())
-          return true;
-        break;
-      }
+      if (k+t == key.length()) // key ends on this path, or branches off to the end label
+        return t == l.length() ? idx : go(idx, t, kEndLabel);
+      if (key[k+t] == kEndLabel) // no key holds it, though branches are labeled with it
+        return INVALID;
       idx = go(idx, t, key[k+t]);
       if (idx == INVALID)
-        return false;
+        return INVALID;
       k += t + 1;
     }
-    return labels_[rankR(idx)].empty();
   }
 
+ public:
+  // Each node is the path of one key. lookup and access map keys to their
+  // ranks [0, size()) in sorted order through rank_, from the preorder
+  // numbers of their nodes.
+  size_t size() const { return labels_.size(); }
+  bool empty() const { return size() == 0; }
+
+  template<typename STR>
+  bool contains(const STR& key) const {
+    return _find(key) != INVALID;
+  }
+
+  // Rank of the key among the sorted keys
+  template<typename STR>
+  std::optional<index_type> lookup(const STR& key) const {
+    auto idx = _find(key);
+    if (idx == INVALID)
+      return std::nullopt;
+    return rank_[rankR(idx)];
+  }
+
+  // Key of the rank, joining the labels of the centroid paths to its node
+  value_type access(index_type rank) const;
+
+  // Sections of a versioned image (image::save and image::load)
+  void write_image(image::Writer& w) const;
+  void read_image(image::Reader& r);
+
   void print_for_debug() const {
     dfuds::print_for_debug();
     std::cout << "Blast" << std::endl;
@@ -270,6 +369,130 @@ class CentroidPathTree : protected Dfuds {
 
 };
 
+
+template<typename Label>
+void CentroidPathTree::_build(const BasicCentroidPathTreeRaw<Label>& raw) {
+  // Each node takes a '(' per child and a ')', and an is_ entry per
+  // distinct branching position.
+  size_t n = 1, num_is = 0;
+  for (auto& node : raw.nodes_) {
+    n += node.ch.size() + 1;
+    index_type pidx = -1;
+    for (auto& [key, nxt] : node.ch)
+      if (key.first != pidx) {
+        pidx = key.first;
+        ++num_is;
+      }
+  }
+  stats_.num_nodes = raw.nodes_.size();
+  labels_.clear();
+  labels_.reserve(raw.nodes_.size());
+  dfuds::bv_ = sdsl::bit_vector(n, kRbra);
+  bl_ = sdsl::bit_vector(n, 0);
+  bs_ = sdsl::bit_vector(n, 0);
+  cs_.assign(n, kDelim);
+  is_ = sdsl::int_vector<>(num_is);
+  up_ = sdsl::int_vector<>(raw.nodes_.size(), 0, 64);
+  sdsl::int_vector<> ranks(raw.nodes_.size(), 0, 64);
+  stats_.mark("count");
+
+  dfuds::bv_[0] = kLbra;
+  size_t off = 1, j = 0;
+  auto dfs = [&](auto& f, index_type id) -> void {
+    const auto& node = raw.nodes_[id];
+    ranks[labels_.size()] = node.rank;
+    labels_.emplace_back(node.l.substr(id == 0 ? 0 : 1));
+    size_t k = 0;
+    if (!node.ch.empty()) {
+      index_type pidx = -1;
+      for (auto& [key, nxt] : node.ch) {
+        auto& [idx,c] = key;
+        dfuds::bv_[off+k] = kLbra;
+        if (idx != pidx) {
+          pidx = idx;
+          assert(id == 0 or idx > 0);
+          is_[j++] = idx - (id == 0 ? 0 : 1);
+          if (k > 0)
+            bl_[off+k-1] = 1;
+        }
+        bs_[off+k] = node.l[idx] < c;
+        cs_[off+k] = c;
+        ++k;
+      }
+      bl_[off+k-1] = 1;
+    }
+    auto first = off;
+    off += k + 1; // ')'
+
+    k = 0;
+    for (auto& [key, nxt] : node.ch) {
+      up_[labels_.size()] = first + k++;
+      f(f, nxt);
+    }
+  };
+  dfs(dfs, 0);
+  assert(off == n and j == num_is);
+  stats_.mark("traverse", sdsl::size_in_bytes(bv_) + sdsl::size_in_bytes(bl_) + sdsl::size_in_bytes(bs_)
+                         + cs_.size() + sdsl::size_in_bytes(is_));
+  rank_ = Permutation<4>(std::move(ranks));
+
+  orchestrate();
+}
+
+
+inline CentroidPathTree::value_type CentroidPathTree::access(index_type rank) const {
+  assert(rank < size());
+  auto id = rank_.inverse(rank);
+  // From the node up, each parent adds its label up to the branching offset
+  // of the child, and the branch byte. Pieces are appended reversed.
+  value_type key(labels_[id].rbegin(), labels_[id].rend());
+  while (id != 0) {
+    auto pos = up_[id];
+    id = rankR(pos);
+    auto c = cs_[pos];
+    if (c != kEndLabel) // else the key ends where the child branches off
+      key += c;
+    auto& l = labels_[id];
+    auto len = is_[bl_rank1_(pos)];
+    key.append(l.rend() - len, l.rend());
+  }
+  std::reverse(key.begin(), key.end());
+  return key;
+}
+
+inline void CentroidPathTree::write_image(image::Writer& w) const {
+  w.begin(image::Type::kCentroidPathTree, image::rank_select_id_v<DefaultRankSelect>);
+  w.section("labels", [&](std::ostream& out) { io::write_strings(out, labels_); });
+  w.section("bv", [&](std::ostream& out) { io::write_int_vector(out, bv_); });
+  w.section("bl", [&](std::ostream& out) { io::write_int_vector(out, bl_); });
+  w.section("bs", [&](std::ostream& out) { io::write_int_vector(out, bs_); });
+  w.section("cs", [&](std::ostream& out) { io::write_vector(out, cs_); });
+  w.section("is", [&](std::ostream& out) { io::write_int_vector(out, is_); });
+  w.section("up", [&](std::ostream& out) { io::write_int_vector(out, up_); });
+  w.section("rank", [&](std::ostream& out) { rank_.serialize(out); });
+  if (w.stores_supports()) {
+    dfuds::_write_supports(w);
+    w.section("bl_rank1", [&](std::ostream& out) { bl_rank1_.serialize(out); });
+    w.section("bl_select1", [&](std::ostream& out) { bl_select1_.serialize(out); });
+  }
+}
+
+inline void CentroidPathTree::read_image(image::Reader& r) {
+  r.expect(image::Type::kCentroidPathTree);
+  stats_.start();
+  r.section("labels", [&](std::istream& in) { io::read_strings(in, labels_); });
+  r.section("bv", [&](std::istream& in) { io::read_int_vector(in, bv_); });
+  r.section("bl", [&](std::istream& in) { io::read_int_vector(in, bl_); });
+  r.section("bs", [&](std::istream& in) { io::read_int_vector(in, bs_); });
+  r.section("cs", [&](std::istream& in) { io::read_vector(in, cs_); });
+  r.section("is", [&](std::istream& in) { io::read_int_vector(in, is_); });
+  r.section("up", [&](std::istream& in) { io::read_int_vector(in, up_); });
+  r.section("rank", [&](std::istream& in) { rank_.load(in); });
+  stats_.num_nodes = labels_.size();
+  stats_.mark("load");
+  orchestrate(&r);
+}
+
 } // strie
 
 #endif //SUCCINCT_TRIES__CENTROID_PATH_TREE_HPP_
@@ -0,0 +1,157 @@
+#ifndef SUCCINCT_TRIES__DATASETS_HPP_
+#define SUCCINCT_TRIES__DATASETS_HPP_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <set>
+#include <random>
+#include <stdexcept>
+#include <iterator>
+#include <utility>
+
+namespace strie {
+namespace datasets {
+
+// Synthetic key sets for tests and benchmarks, sorted and without duplicates.
+// They depend only on (shape, n, seed): the generators draw raw words of
+// std::mt19937_64, whose output the standard fixes, and no distributions.
+// No key holds '\n', so sets can be written one key per line.
+enum class Shape {
+  kUrls,     // scheme, one of n/64 hosts by a skewed choice, and word paths
+  kWords,    // natural-language-like words from syllables, short ones frequent
+  kDna,      // k-mers over ACGT, k in [12, 32]
+  kBinary,   // 8 to 32 random bytes but 0 (the end label) and '\n'
+  kPrefix,   // tails after shared prefixes of 64 to 1024 bytes, and chains
+             // of keys each a prefix of the next
+};
+
+inline const std::vector<std::pair<std::string_view, Shape>>& shapes() {
+  static const std::vector<std::pair<std::string_view, Shape>> list = {
+      {"urls", Shape::kUrls}, {"words", Shape::kWords}, {"dna", Shape::kDna},
+      {"binary", Shape::kBinary}, {"prefix", Shape::kPrefix}};
+  return list;
+}
+
+inline Shape shape_of(std::string_view name) {
+  for (auto& [s, shape] : shapes())
+    if (s == name)
+      return shape;
+  throw std::invalid_argument("Unknown key shape: " + std::string(name));
+}
+
+class Generator {
+  std::mt19937_64 rng_;
+
+  uint64_t _below(uint64_t n) { return rng_() % n; }
+  // Skewed towards small values: about half of the draws fall below n/8.
+  uint64_t _skewed(uint64_t n) { return _below(_below(_below(n) + 1) + 1); }
+
+  std::string _word() {
+    static constexpr std::string_view kOnsets[] = {
+        "", "b", "c", "d", "f", "g", "h", "j", "k", "l", "m", "n", "p", "r", "s", "t",
+        "v", "w", "st", "tr", "ch", "sh", "th", "pr", "bl", "gr", "qu", "sp"};
+    static constexpr std::string_view kNuclei[] = {
+        "a", "e", "i", "o", "u", "y", "ai", "ea", "ee", "ou", "oo", "ie"};
+    static constexpr std::string_view kCodas[] = {
+        "", "", "", "n", "r", "s", "t", "l", "m", "nd", "ng", "st", "ck", "rt"};
+    std::string w;
+    for (auto syllables = 1 + _skewed(5); syllables > 0; syllables--) {
+      w += kOnsets[_below(std::size(kOnsets))];
+      w += kNuclei[_below(std::size(kNuclei))];
+      w += kCodas[_below(std::size(kCodas))];
+    }
+    static constexpr std::string_view kSuffixes[] = {"s", "ed", "ing", "ly", "er"};
+    if (_below(4) == 0)
+      w += kSuffixes[_below(std::size(kSuffixes))];
+    return w;
+  }
+
+  std::string _url(const std::vector<std::string>& hosts) {
+    std::string u = _below(4) ? "https://" : "http://";
+    u += hosts[_skewed(hosts.size())];
+    for (auto depth = _skewed(6); depth > 0; depth--)
+      u += "/" + _word();
+    if (_below(3) == 0)
+      u += "?id=" + std::to_string(_below(100000));
+    return u;
+  }
+
+  std::string _bytes(size_t len, std::string_view alphabet) {
+    std::string s(len, '\0');
+    for (auto& c : s)
+      c = alphabet[_below(alphabet.size())];
+    return s;
+  }
+
+ public:
+  explicit Generator(uint64_t seed = 0) : rng_(seed) {}
+
+  // n distinct keys of the shape, sorted.
+  std::vector<std::string> generate(Shape shape, size_t n);
+};
+
+inline std::vector<std::string> Generator::generate(Shape shape, size_t n) {
+  std::set<std::string> keys;
+  std::vector<std::string> hosts, prefixes;
+  std::string binary_alphabet;
+  for (int c = 1; c < 256; c++)
+    if (c != '\n')
+      binary_alphabet += char(c);
+  if (shape == Shape::kUrls) {
+    for (size_t i = 0; i < n / 64 + 1; i++) {
+      auto h = _word() + (_below(2) ? "." + _word() : "");
+      static constexpr std::string_view kTlds[] = {".com", ".org", ".net", ".io", ".de", ".jp"};
+      hosts.push_back((_below(3) ? "www." : "") + h + std::string(kTlds[_skewed(std::size(kTlds))]));
+    }
+  }
+  if (shape == Shape::kPrefix) {
+    for (size_t i = 0; i < 8; i++)
+      prefixes.push_back(_bytes(64 << _below(5), "abcdefghijklmnopqrstuvwxyz"));
+  }
+  // Every shape has far more than n distinct keys of its lengths, so this
+  // ends after few retries.
+  while (keys.size() < n) {
+    switch (shape) {
+      case Shape::kUrls:
+        keys.insert(_url(hosts));
+        break;
+      case Shape::kWords: {
+        auto w = _word();
+        if (_below(8) == 0) // compounds
+          w += _word();
+        keys.insert(w);
+        break;
+      }
+      case Shape::kDna:
+        keys.insert(_bytes(12 + _below(21), "ACGT"));
+        break;
+      case Shape::kBinary:
+        keys.insert(_bytes(8 + _below(25), binary_alphabet));
+        break;
+      case Shape::kPrefix: {
+        auto p = prefixes[_below(prefixes.size())];
+        if (_below(4) == 0) {
+          // A chain p+t[0..1], p+t[0..2], ... of up to 64 keys
+          auto t = _bytes(1 + _below(64), "ab");
+          for (size_t l = 1; l <= t.size() and keys.size() < n; l++)
+            keys.insert(p + t.substr(0, l));
+        } else {
+          keys.insert(p + _bytes(4 + _below(16), "abcdefghijklmnopqrstuvwxyz"));
+        }
+        break;
+      }
+    }
+  }
+  return std::vector<std::string>(keys.begin(), keys.end());
+}
+
+inline std::vector<std::string> generate(Shape shape, size_t n, uint64_t seed = 0) {
+  return Generator(seed).generate(shape, n);
+}
+
+} // namespace datasets
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__DATASETS_HPP_
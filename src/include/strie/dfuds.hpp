@@ -2,6 +2,12 @@
 #define SUCCINCT_TRIES__DFUDS_HPP_
 
 #include "bp.hpp"
+#include "build_stats.hpp"
+#include "hugepage.hpp"
+#include "image.hpp"
+#include "io.hpp"
+#include "key.hpp"
+#include "rank_select.hpp"
 
 #include <string>
 #include <cstring>
@@ -9,12 +15,15 @@
 #include <iterator>
 #include <type_traits>
 #include <cassert>
+#include <cstdint>
 #include <exception>
 #include <vector>
 #include <queue>
 #include <tuple>
+#include <utility>
 #include <initializer_list>
 #include <iostream>
+#include <limits>
 
 #include <sdsl/int_vector.hpp>
 #include <sdsl/bit_vectors.hpp>
@@ -24,39 +33,79 @@
 
 namespace strie {
 
-class Dfuds {
+template<typename RankSelect = DefaultRankSelect>
+class BasicDfuds {
  public:// for visualization
   static constexpr bool kLbra = 1;
   static constexpr bool kRbra = 0;
   using index_type = size_t;
  protected:
+  using rankL_type = typename RankSelect::template rank_type<kLbra>;
   sdsl::bit_vector bv_;
-  sdsl::rank_support_v<kLbra, 1> rankL_;
-  sdsl::select_support_mcl<kRbra, 1> selectR_;
-  BpSupport<> bp_;
+  rankL_type rankL_;
+  typename RankSelect::template select_type<kRbra> selectR_;
+  typename RankSelect::template bp_type<rankL_type> bp_;
+  BuildStats stats_;
 
-  void orchestrate() {
-    sdsl::util::init_support(rankL_, &bv_);
-    sdsl::util::init_support(selectR_, &bv_);
-    bp_.init_support(&bv_, &rankL_);
+  // Supports of bv_, read from r if it stores them, built otherwise
+  void orchestrate(image::Reader* r = nullptr) {
+    bool stored = r and r->stores_supports(image::rank_select_id_v<RankSelect>);
+    if (stored) {
+      r->section("rankL", [&](std::istream& in) { io::read_support(in, rankL_, &bv_); });
+      r->section("selectR", [&](std::istream& in) { io::read_support(in, selectR_, &bv_); });
+    } else {
+      sdsl::util::init_support(rankL_, &bv_);
+      sdsl::util::init_support(selectR_, &bv_);
+    }
+    stats_.mark("rank_select", sdsl::size_in_bytes(rankL_) + sdsl::size_in_bytes(selectR_));
+    if (stored)
+      r->section("bp", [&](std::istream& in) { bp_.load(in, &bv_, &rankL_); });
+    else
+      bp_.init_support(&bv_, &rankL_);
+    hugepages::advise(bv_);
+    stats_.mark("bp_support", bp_.size_in_bytes());
+  }
+
+  void _write_supports(image::Writer& w) const {
+    w.section("rankL", [&](std::ostream& out) { rankL_.serialize(out); });
+    w.section("selectR", [&](std::ostream& out) { selectR_.serialize(out); });
+    w.section("bp", [&](std::ostream& out) { bp_.serialize(out); });
   }
 
  public:
-  Dfuds() {}
+  BasicDfuds() {}
+
+  // Phases of the last build
+  const BuildStats& build_stats() const { return stats_; }
 
   index_type rankR(index_type i) const {
     return i - rankL_(i);
   }
 
+  // Distance to the next ')' from x. It is found by tzcnt when it lies in
+  // the words holding x and the next one, and by selectR_ otherwise.
   index_type degree(index_type x) const {
+    auto data = bv_.data();
+    auto off = x % 64;
+    uint64_t w = ~data[x / 64] >> off;
+    if (w != 0)
+      return __builtin_ctzll(w);
+    if (x / 64 + 1 < (bv_.size() + 63) / 64 and (w = ~data[x / 64 + 1]) != 0)
+      return 64 - off + __builtin_ctzll(w);
     return selectR_(rankR(x) + 1) - x;
   }
 
-  index_type child(index_type x, index_type i) const {
-    assert(bv_[x + i] == kLbra);
-    auto deg = degree(x);
+  // The first child follows the ')' of x; child i follows the mate of the
+  // '(' i places before that ')'.
+  index_type child(index_type x, index_type i, index_type deg) const {
+    assert(i < deg and bv_[x + i] == kLbra);
+    if (i == 0)
+      return x + deg + 1;
     return bp_.findclose(x + deg - 1 - i) + 1;
   }
+  index_type child(index_type x, index_type i) const {
+    return child(x, i, degree(x));
+  }
 
  public:
   void print_for_debug() const {
@@ -69,23 +118,75 @@ class Dfuds {
 };
 
 
-class DfudsTrie : protected Dfuds {
-  using dfuds = Dfuds;
+using Dfuds = BasicDfuds<>;
+
+
+template<typename RankSelect = DefaultRankSelect>
+class BasicDfudsTrie : protected BasicDfuds<RankSelect> {
+  using dfuds = BasicDfuds<RankSelect>;
  public:
+  using typename dfuds::index_type;
+  using dfuds::kLbra;
+  using dfuds::kRbra;
   using value_type = std::string;
   using char_type = char;
   static constexpr char_type kEndLabel = '\0';
   static constexpr char_type kDelim = '\0';
   static constexpr char_type kRootLabel = '^'; // for visualization
- private:
+ protected:
+  using dfuds::bv_;
+  using dfuds::bp_;
+  using dfuds::stats_;
+  static constexpr index_type INVALID = std::numeric_limits<index_type>::max();
   sdsl::bit_vector leaf_;
-  sdsl::rank_support_v<1, 1> leaf_rank_;
-  std::vector<char_type> chars_;
+  typename RankSelect::template rank_type<1> leaf_rank_;
+  hugepage_vector<char_type> chars_;
   size_t size_;
 
- private:
+ protected:
   template<typename It>
   void _build(It begin, It end);
+  void _init_supports(image::Reader* r = nullptr);
+
+  // Node reached by reading key[k..len) from node idx, or INVALID
+  template<typename STR>
+  index_type _traverse(const STR& key, index_type len, index_type idx = 1, index_type k = 0) const;
+
+  bool _is_leaf(index_type idx) const {
+    return leaf_[dfuds::rankR(idx)];
+  }
+
+  // Index of label c among the deg labels of node idx, or deg.
+  // Compares 8 labels a step, by the zero byte test of (labels ^ c).
+  index_type _find_label(index_type idx, index_type deg, char_type c) const {
+    constexpr uint64_t kOnes = 0x0101010101010101ull;
+    auto p = chars_.data() + idx;
+    index_type i = 0;
+    for (; i + 8 <= deg; i += 8) {
+      uint64_t w;
+      std::memcpy(&w, p + i, 8);
+      w ^= kOnes * (unsigned char) c;
+      auto z = (w - kOnes) & ~w & (kOnes << 7);
+      if (z)
+        return i + __builtin_ctzll(z) / 8;
+    }
+    for (; i < deg; i++)
+      if (p[i] == c)
+        return i;
+    return deg;
+  }
+
+  // Position of the last ')' in the subtree of node idx
+  index_type _subtree_end(index_type idx) const {
+    while (bv_[idx] == kLbra)
+      idx = bp_.findclose(idx) + 1; // last child
+    return idx;
+  }
+
+  // Number of keys preceding node idx in preorder
+  index_type _leaf_rank(index_type idx) const {
+    return leaf_rank_(dfuds::rankR(idx));
+  }
 
   template<typename It>
   void _check_valid_input(It begin, It end) const {
@@ -93,20 +194,21 @@ class DfudsTrie : protected Dfuds {
     if (begin == end)
       return;
     for (auto pre = begin, it = std::next(begin); it != end; ++pre, ++it)
-      if (not (*pre < *it))
+      if (not (key_view(*pre) < key_view(*it)))
         throw std::domain_error("Input string collection is not sorted.");
   }
 
  public:
-  DfudsTrie() : Dfuds(), size_(0) {}
+  BasicDfudsTrie() : dfuds(), size_(0) {}
   template<typename It>
-  DfudsTrie(It begin, It end) : DfudsTrie() {
+  BasicDfudsTrie(It begin, It end) : BasicDfudsTrie() {
     _build(begin, end);
   }
-  DfudsTrie(std::initializer_list<value_type> list) : DfudsTrie(list.begin(), list.end()) {}
+  BasicDfudsTrie(std::initializer_list<value_type> list) : BasicDfudsTrie(list.begin(), list.end()) {}
 
   size_t size() const { return size_; }
   bool empty() const { return size() == 0; }
+  using dfuds::build_stats;
 
   template<typename STR>
   bool contains(STR&& key, index_type len) const;
@@ -114,6 +216,14 @@ class DfudsTrie : protected Dfuds {
   bool contains(std::string_view key) const { return contains(key, key.length()); }
   bool contains(const char* key) const { return contains(key, std::strlen(key)); }
 
+  // Call f(key) for every key in sorted order.
+  template<typename F>
+  void for_each(F&& f) const;
+
+  // Sections of a versioned image (image::save and image::load)
+  void write_image(image::Writer& w) const;
+  void read_image(image::Reader& r);
+
  public:
   void print_for_debug() const {
     for (int i = 0; i < bv_.size(); i++)
@@ -129,74 +239,153 @@ class DfudsTrie : protected Dfuds {
 
 };
 
+template<typename RankSelect>
 template<typename It>
-void DfudsTrie::_build(It begin, It end) {
+void BasicDfudsTrie<RankSelect>::_build(It begin, It end) {
   using traits = std::iterator_traits<It>;
-  static_assert(std::is_convertible_v<typename traits::value_type, value_type>);
+  static_assert(is_key_v<typename traits::value_type>);
   static_assert(std::is_base_of_v<std::forward_iterator_tag, typename traits::iterator_category>);
 
+  stats_.start();
   _check_valid_input(begin, end);
+  stats_.mark("validate");
+
+  // n nodes take 2n bits: the root's '(', and a '(' per child and a ')' for each node.
+  auto n = count_trie_nodes(begin, end);
+  stats_.num_nodes = n;
+  bv_ = sdsl::bit_vector(2 * n, kRbra);
+  leaf_ = sdsl::bit_vector(n, 0);
+  chars_.assign(2 * n, kDelim);
+  stats_.mark("count");
 
-  bv_.resize(1);
   bv_[0] = kLbra;
-  chars_.resize(1);
   chars_[0] = kRootLabel;
-
-  std::vector<char_type> cs;
+  size_t t = 1, l = 0;
   auto dfs = [&](auto& f, It b, It e, size_t d) -> void {
     assert(b != e);
     auto it = b;
     bool has_leaf = false;
-    if ((*it).length() == d) {
+    if (key_view(*it).length() == d) {
       has_leaf = true;
       ++it;
     }
-    cs.clear();
     std::vector<std::tuple<It,It>> ns;
     while (it != e) {
-      auto t = it;
-      auto c = (*t)[d];
-      cs.push_back(c);
+      auto u = it;
+      auto c = key_view(*u)[d];
+      bv_[t] = kLbra;
+      chars_[t++] = c;
       ++it;
-      while (it != e and (*it)[d] == c)
+      while (it != e and key_view(*it)[d] == c)
         ++it;
-      ns.emplace_back(t, it);
-    }
-    size_t t = bv_.size();
-    bv_.resize(t + cs.size() + 1);
-    chars_.resize(t + cs.size() + 1);
-    for (size_t i = 0; i < cs.size(); i++) {
-      bv_[t + i] = kLbra;
-      chars_[t + i] = cs[i];
+      ns.emplace_back(u, it);
     }
-    bv_[t + cs.size()] = kRbra;
-    chars_[t + cs.size()] = kDelim;
-    leaf_.resize(leaf_.size()+1);
-    leaf_[leaf_.size()-1] = has_leaf;
+    t++; // ')'
+    leaf_[l++] = has_leaf;
     for (auto [b,e] : ns)
       f(f, b, e, d+1);
   };
   dfs(dfs, begin, end, 0);
+  assert(t == bv_.size() and l == leaf_.size());
+  stats_.mark("traverse", sdsl::size_in_bytes(bv_) + sdsl::size_in_bytes(leaf_) + chars_.size());
 
-  orchestrate();
-  sdsl::util::init_support(leaf_rank_, &leaf_);
+  _init_supports();
+}
 
+template<typename RankSelect>
+void BasicDfudsTrie<RankSelect>::_init_supports(image::Reader* r) {
+  dfuds::orchestrate(r);
+  if (r and r->stores_supports(image::rank_select_id_v<RankSelect>))
+    r->section("leaf_rank", [&](std::istream& in) { io::read_support(in, leaf_rank_, &leaf_); });
+  else
+    sdsl::util::init_support(leaf_rank_, &leaf_);
+  size_ = leaf_rank_(leaf_.size());
+  hugepages::advise(leaf_);
+  stats_.mark("leaf_rank", sdsl::size_in_bytes(leaf_rank_));
 }
 
+template<typename RankSelect>
+void BasicDfudsTrie<RankSelect>::write_image(image::Writer& w) const {
+  w.begin(image::Type::kDfuds, image::rank_select_id_v<RankSelect>);
+  w.section("bv", [&](std::ostream& out) { io::write_int_vector(out, bv_); });
+  w.section("leaf", [&](std::ostream& out) { io::write_int_vector(out, leaf_); });
+  w.section("chars", [&](std::ostream& out) { io::write_vector(out, chars_); });
+  if (w.stores_supports()) {
+    dfuds::_write_supports(w);
+    w.section("leaf_rank", [&](std::ostream& out) { leaf_rank_.serialize(out); });
+  }
+}
+
+template<typename RankSelect>
+void BasicDfudsTrie<RankSelect>::read_image(image::Reader& r) {
+  r.expect(image::Type::kDfuds);
+  stats_.start();
+  r.section("bv", [&](std::istream& in) { io::read_int_vector(in, bv_); });
+  r.section("leaf", [&](std::istream& in) { io::read_int_vector(in, leaf_); });
+  r.section("chars", [&](std::istream& in) { io::read_vector(in, chars_); });
+  stats_.num_nodes = leaf_.size();
+  stats_.mark("load", sdsl::size_in_bytes(bv_) + sdsl::size_in_bytes(leaf_) + chars_.size());
+  _init_supports(&r);
+}
+
+template<typename RankSelect>
 template<typename STR>
-bool DfudsTrie::contains(STR&& key, index_type len) const {
-  index_type idx = 1;
-  for (index_type k = 0; k < len; k++) {
-    index_type i = 0;
-    while (bv_[idx + i] == kLbra and chars_[idx + i] < key[k])
-      i++;
-    if (chars_[idx + i] != key[k])
-      return false;
-    idx = dfuds::child(idx, i);
+typename BasicDfudsTrie<RankSelect>::index_type
+BasicDfudsTrie<RankSelect>::_traverse(const STR& key, index_type len, index_type idx, index_type k) const {
+  for (; k < len; k++) {
+    auto deg = dfuds::degree(idx);
+    auto i = _find_label(idx, deg, key[k]);
+    if (i == deg)
+      return INVALID;
+    idx = dfuds::child(idx, i, deg);
+  }
+  return idx;
+}
+
+template<typename RankSelect>
+template<typename STR>
+bool BasicDfudsTrie<RankSelect>::contains(STR&& key, index_type len) const {
+  auto idx = _traverse(key, len);
+  return idx != INVALID and _is_leaf(idx);
+}
+
+template<typename RankSelect>
+template<typename F>
+void BasicDfudsTrie<RankSelect>::for_each(F&& f) const {
+  if (empty())
+    return;
+  // Nodes lie in preorder, each its degree of '(' and a ')', so a scan of
+  // the parentheses visits them in key order without findclose. For each
+  // node on the path: the label of the child being visited, and the end of
+  // its labels.
+  value_type key;
+  std::vector<std::pair<index_type, index_type>> path;
+  for (index_type x = 1, node = 0; x < bv_.size(); node++) {
+    if (leaf_[node])
+      f(std::as_const(key));
+    auto deg = dfuds::degree(x);
+    if (deg > 0) {
+      path.emplace_back(x, x + deg);
+      key.push_back(chars_[x]);
+    } else {
+      while (!path.empty()) {
+        auto& [c, e] = path.back();
+        key.pop_back();
+        if (++c < e) {
+          key.push_back(chars_[c]);
+          break;
+        }
+        path.pop_back();
+      }
+    }
+    x += deg + 1;
   }
-  return leaf_[dfuds::rankR(idx)];
 }
 
+using DfudsTrie = BasicDfudsTrie<>;
+using FastDfudsTrie = BasicDfudsTrie<FastRankSelect>;
+using SmallDfudsTrie = BasicDfudsTrie<SmallRankSelect>;
+
 } // namespace strie
 
 #endif //SUCCINCT_TRIES__DFUDS_HPP_
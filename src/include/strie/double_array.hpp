@@ -0,0 +1,236 @@
+#ifndef SUCCINCT_TRIES__DOUBLE_ARRAY_HPP_
+#define SUCCINCT_TRIES__DOUBLE_ARRAY_HPP_
+
+#include <string>
+#include <cstring>
+#include <string_view>
+#include <iterator>
+#include <type_traits>
+#include <cassert>
+#include <cstdint>
+#include <exception>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include <initializer_list>
+#include <iostream>
+
+#include "key.hpp"
+
+namespace strie {
+
+// Double-array trie with tail compression.
+// Not succinct: each transition is one BASE/CHECK probe, without rank/select.
+// BASE and CHECK are interleaved so that a probe touches a single unit.
+// A node with only one key below stores the rest of it in TAIL instead.
+class DoubleArrayTrie {
+ public:
+  using value_type = std::string;
+  using char_type = char;
+  using index_type = size_t;
+  static constexpr char_type kEndLabel = '\0';
+ private:
+  struct Unit {
+    int32_t base;  // < 0: -(offset in tail_ + 1)
+    int32_t check; // parent, or kFree
+  };
+  static constexpr int32_t kFree = -1;
+  static constexpr unsigned kEndCode = 0;
+  std::vector<Unit> units_;
+  std::vector<char_type> tail_;
+  size_t size_;
+
+  static unsigned _code(char_type c) { return (unsigned char) c + 1; }
+
+  template<typename It>
+  void _build(It begin, It end);
+
+  template<typename It>
+  void _check_valid_input(It begin, It end) const {
+    // Check input be sorted.
+    if (begin == end)
+      return;
+    for (auto pre = begin, it = std::next(begin); it != end; ++pre, ++it)
+      if (not (key_view(*pre) < key_view(*it)))
+        throw std::domain_error("Input string collection is not sorted.");
+  }
+
+  // Child of s by code, or kFree
+  int32_t _go(int32_t s, unsigned code) const {
+    auto t = units_[s].base + (int32_t) code;
+    return (size_t) t < units_.size() and units_[t].check == s ? t : kFree;
+  }
+
+ public:
+  DoubleArrayTrie() : size_(0) {}
+  template<typename It>
+  DoubleArrayTrie(It begin, It end) : DoubleArrayTrie() {
+    _build(begin, end);
+  }
+  DoubleArrayTrie(std::initializer_list<value_type> list) : DoubleArrayTrie(list.begin(), list.end()) {}
+
+  size_t size() const { return size_; }
+  bool empty() const { return size() == 0; }
+
+  template<typename STR>
+  bool contains(STR&& key, index_type len) const;
+  bool contains(const std::string& key) const { return contains(key, key.length()); }
+  bool contains(std::string_view key) const { return contains(key, key.length()); }
+  bool contains(const char* key) const { return contains(key, std::strlen(key)); }
+
+  // Call f(key) for every key in sorted order.
+  template<typename F>
+  void for_each(F&& f) const;
+
+ public:
+  void print_for_debug() const {
+    for (size_t i = 0; i < units_.size(); i++)
+      std::cout << i << "] " << units_[i].base << ' ' << units_[i].check << std::endl;
+    for (auto c : tail_)
+      std::cout << (c == kEndLabel ? '$' : c);
+    std::cout << std::endl;
+  }
+
+};
+
+template<typename It>
+void DoubleArrayTrie::_build(It begin, It end) {
+  using traits = std::iterator_traits<It>;
+  static_assert(is_key_v<typename traits::value_type>);
+  static_assert(std::is_base_of_v<std::forward_iterator_tag, typename traits::iterator_category>);
+
+  _check_valid_input(begin, end);
+
+  units_.assign(1, {0, 0});
+  tail_.clear();
+  size_ = 0;
+  // Smallest free unit not before i, with path halving over occupied units.
+  std::vector<size_t> skip = {1};
+  auto next_free = [&](size_t i) {
+    while (i < skip.size() and skip[i] != i) {
+      if (skip[i] < skip.size())
+        skip[i] = skip[skip[i]];
+      i = skip[i];
+    }
+    return i;
+  };
+  auto dfs = [&](auto& f, int32_t s, It b, It e, size_t d) -> void {
+    assert(b != e);
+    if (std::next(b) == e) {
+      auto key = key_view(*b);
+      units_[s].base = -(int32_t) tail_.size() - 1;
+      tail_.insert(tail_.end(), key.begin() + d, key.end());
+      tail_.push_back(kEndLabel);
+      ++size_;
+      return;
+    }
+    std::vector<std::tuple<unsigned, It, It>> ns;
+    auto it = b;
+    if (key_view(*it).length() == d) {
+      ns.emplace_back(kEndCode, it, std::next(it));
+      ++it;
+    }
+    while (it != e) {
+      auto t = it;
+      auto c = key_view(*t)[d];
+      ++it;
+      while (it != e and key_view(*it)[d] == c)
+        ++it;
+      ns.emplace_back(_code(c), t, it);
+    }
+    // Find the first base placing all children on free units.
+    auto head = std::get<0>(ns.front());
+    size_t x;
+    for (auto pos = next_free(head + 1); ; pos = next_free(pos + 1)) {
+      x = pos - head;
+      bool ok = true;
+      for (auto& n : ns) {
+        auto t = x + std::get<0>(n);
+        if (t < units_.size() and units_[t].check != kFree) {
+          ok = false;
+          break;
+        }
+      }
+      if (ok)
+        break;
+    }
+    auto last = x + std::get<0>(ns.back());
+    if (last >= units_.size())
+      units_.resize(last + 1, {0, kFree});
+    while (skip.size() < units_.size())
+      skip.push_back(skip.size());
+    units_[s].base = x;
+    for (auto& n : ns) {
+      auto t = x + std::get<0>(n);
+      units_[t].check = s;
+      skip[t] = t + 1;
+    }
+    for (auto& [code, cb, ce] : ns) {
+      auto t = x + code;
+      if (code == kEndCode) {
+        units_[t].base = 0;
+        ++size_;
+      } else {
+        f(f, t, cb, ce, d+1);
+      }
+    }
+  };
+  if (begin != end)
+    dfs(dfs, 0, begin, end, 0);
+  units_.shrink_to_fit();
+  tail_.shrink_to_fit();
+}
+
+template<typename STR>
+bool DoubleArrayTrie::contains(STR&& key, index_type len) const {
+  if (empty())
+    return false;
+  int32_t s = 0;
+  for (index_type k = 0; k < len; k++) {
+    if (units_[s].base < 0) {
+      auto tail = tail_.data() + (-units_[s].base - 1);
+      for (; k < len; k++, tail++)
+        if (*tail != key[k] or *tail == kEndLabel)
+          return false;
+      return *tail == kEndLabel;
+    }
+    s = _go(s, _code(key[k]));
+    if (s == kFree)
+      return false;
+  }
+  if (units_[s].base < 0)
+    return tail_[-units_[s].base - 1] == kEndLabel;
+  return _go(s, kEndCode) != kFree;
+}
+
+template<typename F>
+void DoubleArrayTrie::for_each(F&& f) const {
+  if (empty())
+    return;
+  value_type key;
+  auto dfs = [&](auto& g, int32_t s) -> void {
+    if (units_[s].base < 0) {
+      auto n = key.size();
+      key += tail_.data() + (-units_[s].base - 1);
+      f(std::as_const(key));
+      key.resize(n);
+      return;
+    }
+    if (_go(s, kEndCode) != kFree)
+      f(std::as_const(key));
+    for (unsigned code = 1; code <= 256; code++) {
+      auto t = _go(s, code);
+      if (t == kFree)
+        continue;
+      key.push_back((char_type) (code - 1));
+      g(g, t);
+      key.pop_back();
+    }
+  };
+  dfs(dfs, 0);
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__DOUBLE_ARRAY_HPP_
@@ -0,0 +1,201 @@
+#ifndef SUCCINCT_TRIES__DYNAMIC_TRIE_HPP_
+#define SUCCINCT_TRIES__DYNAMIC_TRIE_HPP_
+
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <thread>
+#include <set>
+#include <vector>
+#include <utility>
+
+namespace strie {
+
+// Updatable front of a static trie T (Louds, DfudsTrie).
+// Inserts go to a sorted delta set and erases to a tombstone set. Once they
+// hold `threshold` keys, they are frozen and merged with the keys of T into a
+// fresh T by a background thread, while queries keep consulting every layer:
+//   delta/tombstones -> frozen delta/tombstones -> static trie.
+template<typename T>
+class DynamicTrie {
+ public:
+  using trie_type = T;
+  using value_type = std::string;
+  static constexpr size_t kDefaultThreshold = 1 << 16;
+ private:
+  using set_type = std::set<value_type, std::less<>>;
+  std::shared_ptr<const trie_type> base_;
+  set_type delta_, tombstones_;
+  set_type frozen_delta_, frozen_tombstones_;
+  size_t threshold_;
+  size_t size_;
+  bool merging_ = false;
+  std::thread merger_;
+  mutable std::shared_mutex mtx_;
+  std::condition_variable_any merged_;
+
+  bool _base_contains(std::string_view key) const {
+    return !base_->empty() and base_->contains(key);
+  }
+
+  // Whether key is in the layers below the live delta
+  bool _frozen_contains(std::string_view key) const {
+    if (frozen_delta_.count(key))
+      return true;
+    if (frozen_tombstones_.count(key))
+      return false;
+    return _base_contains(key);
+  }
+
+  bool _contains(std::string_view key) const {
+    if (delta_.count(key))
+      return true;
+    if (tombstones_.count(key))
+      return false;
+    return _frozen_contains(key);
+  }
+
+  // Both require unique lock.
+  void _start_merge();
+  void _wait_merge(std::unique_lock<std::shared_mutex>& lock) {
+    merged_.wait(lock, [&] { return !merging_; });
+    if (merger_.joinable())
+      merger_.join();
+  }
+
+  static std::shared_ptr<const trie_type>
+  _merged(const trie_type& base, const set_type& delta, const set_type& tombstones);
+
+ public:
+  explicit DynamicTrie(size_t threshold = kDefaultThreshold)
+      : base_(std::make_shared<trie_type>()), threshold_(threshold), size_(0) {}
+  template<typename It>
+  DynamicTrie(It begin, It end, size_t threshold = kDefaultThreshold)
+      : base_(begin == end ? std::make_shared<trie_type>() : std::make_shared<trie_type>(begin, end)),
+        threshold_(threshold), size_(base_->size()) {}
+  DynamicTrie(const DynamicTrie&) = delete;
+  DynamicTrie& operator=(const DynamicTrie&) = delete;
+  ~DynamicTrie() {
+    std::unique_lock lock(mtx_);
+    _wait_merge(lock);
+  }
+
+  size_t size() const {
+    std::shared_lock lock(mtx_);
+    return size_;
+  }
+  bool empty() const { return size() == 0; }
+
+  bool contains(std::string_view key) const {
+    std::shared_lock lock(mtx_);
+    return _contains(key);
+  }
+
+  // Returns false if key was already contained.
+  bool insert(std::string_view key);
+
+  // Returns false if key was not contained.
+  bool erase(std::string_view key);
+
+  // Merge pending updates into the static trie and wait for it.
+  void flush();
+
+  // Current static trie, not reflecting pending updates.
+  std::shared_ptr<const trie_type> base() const {
+    std::shared_lock lock(mtx_);
+    return base_;
+  }
+
+};
+
+template<typename T>
+bool DynamicTrie<T>::insert(std::string_view key) {
+  std::unique_lock lock(mtx_);
+  if (_contains(key))
+    return false;
+  auto t = tombstones_.find(key);
+  if (t != tombstones_.end())
+    tombstones_.erase(t);
+  else
+    delta_.emplace(key);
+  ++size_;
+  if (delta_.size() + tombstones_.size() >= threshold_)
+    _start_merge();
+  return true;
+}
+
+template<typename T>
+bool DynamicTrie<T>::erase(std::string_view key) {
+  std::unique_lock lock(mtx_);
+  if (!_contains(key))
+    return false;
+  auto d = delta_.find(key);
+  if (d != delta_.end())
+    delta_.erase(d);
+  else
+    tombstones_.emplace(key);
+  --size_;
+  if (delta_.size() + tombstones_.size() >= threshold_)
+    _start_merge();
+  return true;
+}
+
+template<typename T>
+void DynamicTrie<T>::_start_merge() {
+  // A running merge holds the frozen layer; the live delta keeps growing
+  // until it is done.
+  if (merging_)
+    return;
+  if (merger_.joinable())
+    merger_.join();
+  frozen_delta_.swap(delta_);
+  frozen_tombstones_.swap(tombstones_);
+  merging_ = true;
+  merger_ = std::thread([this, base = base_] {
+    auto merged = _merged(*base, frozen_delta_, frozen_tombstones_);
+    std::unique_lock lock(mtx_);
+    base_ = std::move(merged);
+    frozen_delta_.clear();
+    frozen_tombstones_.clear();
+    merging_ = false;
+    merged_.notify_all();
+  });
+}
+
+template<typename T>
+void DynamicTrie<T>::flush() {
+  std::unique_lock lock(mtx_);
+  _wait_merge(lock);
+  if (delta_.empty() and tombstones_.empty())
+    return;
+  _start_merge();
+  _wait_merge(lock);
+}
+
+template<typename T>
+std::shared_ptr<const T>
+DynamicTrie<T>::_merged(const trie_type& base, const set_type& delta, const set_type& tombstones) {
+  // Frozen layers are only read by queries while the merge runs.
+  std::vector<value_type> keys;
+  keys.reserve(base.size() + delta.size());
+  auto d = delta.begin();
+  base.for_each([&](const value_type& key) {
+    for (; d != delta.end() and *d < key; ++d)
+      keys.push_back(*d);
+    if (!tombstones.count(key))
+      keys.push_back(key);
+  });
+  keys.insert(keys.end(), d, delta.end());
+  if (keys.empty())
+    return std::make_shared<trie_type>();
+  return std::make_shared<trie_type>(keys.begin(), keys.end());
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__DYNAMIC_TRIE_HPP_
@@ -0,0 +1,186 @@
+#ifndef SUCCINCT_TRIES__HUGEPAGE_HPP_
+#define SUCCINCT_TRIES__HUGEPAGE_HPP_
+
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include <sdsl/int_vector.hpp>
+
+namespace strie {
+
+// Placement of trie storage on huge pages.
+//
+// hugepages::enable() is process-wide and should be called before building.
+// Buffers of HugePageAllocator of at least a huge page, the label arrays, are
+// then mapped with MAP_HUGETLB while reserved huge pages are free and within
+// the pool bound, and else 2MB aligned with madvise(MADV_HUGEPAGE). Tries
+// advise their largest sdsl vectors after building: bit vectors, leaf flags
+// and BpSupport levels. sdsl's own pool (memory_manager::use_hugepages) is
+// not used, since it throws once full and cannot be turned off; rank/select
+// directories therefore get huge pages only where THP is "always".
+namespace hugepages {
+
+enum class Mode { kNone, kTransparent, kHugeTLB };
+
+constexpr size_t kPageSize = 2ull << 20;
+
+inline Mode& mode() {
+  static Mode m = Mode::kNone;
+  return m;
+}
+
+// Bytes of MAP_HUGETLB mappings allowed, and in use
+inline size_t& pool_bytes() {
+  static size_t bytes = 0;
+  return bytes;
+}
+inline std::atomic<size_t>& pool_used() {
+  static std::atomic<size_t> used{0};
+  return used;
+}
+
+// kHugeTLB if a reserved huge page can be mapped, else kTransparent.
+// pool_bytes = 0 bounds MAP_HUGETLB mappings only by the free huge pages.
+inline Mode enable(size_t pool_bytes = 0) {
+  if (mode() != Mode::kNone)
+    return mode();
+  mode() = Mode::kTransparent;
+#ifdef MAP_HUGETLB
+  void* p = mmap(nullptr, kPageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (p != MAP_FAILED) {
+    munmap(p, kPageSize);
+    hugepages::pool_bytes() = pool_bytes ? pool_bytes : SIZE_MAX;
+    mode() = Mode::kHugeTLB;
+  }
+#endif
+  return mode();
+}
+
+// MAP_HUGETLB mappings of map()
+inline std::mutex& _hugetlb_mutex() {
+  static std::mutex m;
+  return m;
+}
+inline std::unordered_set<const void*>& _hugetlb_maps() {
+  static std::unordered_set<const void*> maps;
+  return maps;
+}
+
+// Whether p was mapped by map() with MAP_HUGETLB
+inline bool is_hugetlb(const void* p) {
+  std::lock_guard<std::mutex> lock(_hugetlb_mutex());
+  return _hugetlb_maps().count(p) != 0;
+}
+
+// bytes, a multiple of kPageSize, on reserved huge pages within the pool,
+// else on transparent huge pages; nullptr if out of memory.
+inline void* map(size_t bytes) {
+  void* p = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  if (mode() == Mode::kHugeTLB and pool_used().fetch_add(bytes) + bytes <= pool_bytes())
+    p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (p != MAP_FAILED) {
+    std::lock_guard<std::mutex> lock(_hugetlb_mutex());
+    _hugetlb_maps().insert(p);
+    return p;
+  }
+  if (mode() == Mode::kHugeTLB)
+    pool_used() -= bytes;
+#endif
+  p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (p == MAP_FAILED)
+    return nullptr;
+#ifdef MADV_HUGEPAGE
+  if (mode() != Mode::kNone)
+    madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+  return p;
+}
+
+inline void unmap(void* p, size_t bytes) {
+  munmap(p, bytes);
+  std::lock_guard<std::mutex> lock(_hugetlb_mutex());
+  if (_hugetlb_maps().erase(p))
+    pool_used() -= bytes;
+}
+
+// Ask for transparent huge pages over the 2MB pages inside [ptr, ptr+bytes).
+inline void advise(const void* ptr, size_t bytes) {
+#ifdef MADV_HUGEPAGE
+  if (mode() == Mode::kNone)
+    return;
+  auto b = (reinterpret_cast<uintptr_t>(ptr) + kPageSize - 1) / kPageSize * kPageSize;
+  auto e = (reinterpret_cast<uintptr_t>(ptr) + bytes) / kPageSize * kPageSize;
+  if (b >= e)
+    return;
+  madvise(reinterpret_cast<void*>(b), e - b, MADV_HUGEPAGE);
+#ifdef MADV_COLLAPSE
+  madvise(reinterpret_cast<void*>(b), e - b, MADV_COLLAPSE); // don't wait for khugepaged
+#endif
+#endif
+}
+
+template<uint8_t W>
+void advise(const sdsl::int_vector<W>& v) {
+  advise(v.data(), sdsl::size_in_bytes(v));
+}
+
+} // namespace hugepages
+
+// STL allocator mapping buffers of at least a huge page on their own, so
+// that they are on huge pages once hugepages::enable() was called. Past the
+// free huge pages or the pool bound, buffers fall back to transparent huge
+// pages.
+template<typename T>
+class HugePageAllocator {
+ public:
+  using value_type = T;
+
+  HugePageAllocator() = default;
+  template<typename U>
+  HugePageAllocator(const HugePageAllocator<U>&) noexcept {}
+
+  T* allocate(size_t n) {
+    auto bytes = n * sizeof(T);
+    if (bytes < hugepages::kPageSize) {
+      if (auto p = std::malloc(bytes))
+        return static_cast<T*>(p);
+      throw std::bad_alloc();
+    }
+    if (auto p = hugepages::map(_mapped_size(n)))
+      return static_cast<T*>(p);
+    throw std::bad_alloc();
+  }
+
+  void deallocate(T* p, size_t n) noexcept {
+    if (n * sizeof(T) < hugepages::kPageSize)
+      std::free(p);
+    else
+      hugepages::unmap(p, _mapped_size(n));
+  }
+
+  template<typename U>
+  bool operator==(const HugePageAllocator<U>&) const noexcept { return true; }
+  template<typename U>
+  bool operator!=(const HugePageAllocator<U>&) const noexcept { return false; }
+
+ private:
+  static size_t _mapped_size(size_t n) {
+    return (n * sizeof(T) + hugepages::kPageSize - 1) / hugepages::kPageSize * hugepages::kPageSize;
+  }
+};
+
+template<typename T>
+using hugepage_vector = std::vector<T, HugePageAllocator<T>>;
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__HUGEPAGE_HPP_
@@ -0,0 +1,362 @@
+#ifndef SUCCINCT_TRIES__IMAGE_HPP_
+#define SUCCINCT_TRIES__IMAGE_HPP_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <utility>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <algorithm>
+
+#include "io.hpp"
+
+namespace strie {
+namespace image {
+
+// Versioned container of trie images:
+//
+//   header    magic "strieimg", version, structure type, rank/select id,
+//             flags, number of sections and checksum of the section table
+//   table     name, offset, size and checksum of each section
+//   sections  each at a multiple of kAlign from the start of the image
+//
+// Sections hold the vectors of a trie as io.hpp writes them and, with
+// Supports::kStore, its rank/select directories and BpSupport. Otherwise, or
+// if the image was written with another rank/select policy, loading rebuilds
+// them from the vectors: a smaller image against a longer startup.
+//
+// A Reader parses either an istream, copying each section before checking
+// it, or an image in memory such as a MappedFile, in place. Tries copy their
+// vectors out of the image either way, since sdsl vectors own their words.
+//
+// Version 2 pads int_vector headers to 64 bytes (io::kIntVectorHeader).
+constexpr char kMagic[8] = {'s', 't', 'r', 'i', 'e', 'i', 'm', 'g'};
+constexpr uint32_t kVersion = 2;
+constexpr size_t kAlign = 64;
+constexpr size_t kNameLength = 16;
+constexpr uint64_t kMaxSections = 256;
+constexpr uint32_t kSupportsStored = 1;
+constexpr uint32_t kNoRankSelectId = ~uint32_t(0);
+
+enum class Type : uint32_t { kLouds = 1, kDfuds = 2, kCentroidPathTree = 3 };
+enum class Supports { kRebuild, kStore };
+
+inline const char* type_name(Type type) {
+  switch (type) {
+    case Type::kLouds: return "louds";
+    case Type::kDfuds: return "dfuds";
+    case Type::kCentroidPathTree: return "centroid";
+  }
+  return "unknown";
+}
+
+// Id of a rank/select policy, RankSelect::kImageId, or kNoRankSelectId for
+// policies without one, whose supports are never stored.
+template<typename RankSelect, typename = void>
+struct rank_select_id { static constexpr uint32_t value = kNoRankSelectId; };
+template<typename RankSelect>
+struct rank_select_id<RankSelect, std::void_t<decltype(RankSelect::kImageId)>> {
+  static constexpr uint32_t value = RankSelect::kImageId;
+};
+template<typename RankSelect>
+constexpr uint32_t rank_select_id_v = rank_select_id<RankSelect>::value;
+
+// 64-bit hash of n bytes, read 8 at a time
+inline uint64_t checksum(const char* p, size_t n) {
+  constexpr uint64_t k1 = 0x9E3779B97F4A7C15ull, k2 = 0xC2B2AE3D27D4EB4Full;
+  uint64_t h = n * k1;
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    uint64_t w;
+    std::memcpy(&w, p + i, 8);
+    h ^= w * k2;
+    h = (h << 31 | h >> 33) * k1;
+  }
+  uint64_t w = 0;
+  std::memcpy(&w, p + i, n - i);
+  h ^= w * k2;
+  h ^= h >> 29;
+  h *= k1;
+  return h ^ (h >> 32);
+}
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t type;
+  uint32_t rank_select;
+  uint32_t flags;
+  uint64_t num_sections;
+  uint64_t table_checksum;
+};
+
+struct Section {
+  char name[kNameLength];
+  uint64_t offset;
+  uint64_t size;
+  uint64_t checksum;
+};
+
+inline uint64_t align(uint64_t x) {
+  return (x + kAlign - 1) / kAlign * kAlign;
+}
+
+class Writer {
+  Supports supports_;
+  Type type_ = Type::kLouds;
+  uint32_t rank_select_ = kNoRankSelectId;
+  std::vector<std::pair<std::string, std::string>> sections_;
+
+ public:
+  explicit Writer(Supports supports = Supports::kRebuild) : supports_(supports) {}
+
+  void begin(Type type, uint32_t rank_select) {
+    type_ = type;
+    rank_select_ = rank_select;
+    sections_.clear();
+  }
+
+  bool stores_supports() const {
+    return supports_ == Supports::kStore and rank_select_ != kNoRankSelectId;
+  }
+
+  // Section of what f writes to the given ostream
+  template<typename F>
+  void section(std::string_view name, F&& f);
+
+  // Write the image; returns its size.
+  size_t write(std::ostream& out) const;
+};
+
+// istream over bytes in memory
+class MemoryBuffer : public std::streambuf {
+ public:
+  MemoryBuffer(const char* p, size_t n) {
+    auto q = const_cast<char*>(p); // only read
+    setg(q, q, q + n);
+  }
+};
+
+// A file mapped read-only, e.g. an image for Reader(data, size)
+class MappedFile {
+  void* data_ = MAP_FAILED;
+  size_t size_ = 0;
+
+ public:
+  explicit MappedFile(const std::string& path);
+  ~MappedFile() {
+    if (data_ != MAP_FAILED)
+      munmap(data_, size_);
+  }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* data() const { return size_ ? static_cast<const char*>(data_) : ""; }
+  size_t size() const { return size_; }
+};
+
+class Reader {
+  std::istream* in_ = nullptr;
+  std::streampos base_;
+  const char* data_ = nullptr; // image in memory, if not read from in_
+  size_t size_ = 0;
+  Header header_;
+  std::vector<Section> table_;
+
+  const Section* _find(std::string_view name) const {
+    for (auto& s : table_)
+      if (name == std::string_view(s.name, strnlen(s.name, kNameLength)))
+        return &s;
+    return nullptr;
+  }
+
+  void _read_table(std::istream& in);
+
+ public:
+  // Reads the header and section table from the current position of in.
+  explicit Reader(std::istream& in);
+  // Reads the image at [data, data + size), which must outlive the Reader.
+  Reader(const char* data, size_t size);
+
+  uint32_t version() const { return header_.version; }
+  Type type() const { return Type(header_.type); }
+  void expect(Type type) const {
+    if (this->type() != type)
+      throw std::runtime_error(std::string("Trie image holds a ") + type_name(this->type())
+                               + " trie, not a " + type_name(type) + " trie.");
+  }
+  bool stores_supports(uint32_t rank_select) const {
+    return (header_.flags & kSupportsStored) and rank_select != kNoRankSelectId
+        and rank_select == header_.rank_select;
+  }
+  bool has(std::string_view name) const { return _find(name) != nullptr; }
+
+  // Call f with an istream over the section, after checking its checksum.
+  template<typename F>
+  void section(std::string_view name, F&& f);
+};
+
+template<typename F>
+void Writer::section(std::string_view name, F&& f) {
+  if (name.size() >= kNameLength)
+    throw std::invalid_argument("Section name is too long: " + std::string(name));
+  std::ostringstream os;
+  f(static_cast<std::ostream&>(os));
+  sections_.emplace_back(name, os.str());
+}
+
+inline size_t Writer::write(std::ostream& out) const {
+  std::vector<Section> table(sections_.size());
+  uint64_t offset = align(sizeof(Header) + table.size() * sizeof(Section));
+  for (size_t i = 0; i < table.size(); i++) {
+    auto& [name, data] = sections_[i];
+    std::memset(table[i].name, 0, kNameLength);
+    std::memcpy(table[i].name, name.data(), name.size());
+    table[i].offset = offset;
+    table[i].size = data.size();
+    table[i].checksum = checksum(data.data(), data.size());
+    offset = align(offset + data.size());
+  }
+  Header header;
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.type = uint32_t(type_);
+  header.rank_select = rank_select_;
+  header.flags = stores_supports() ? kSupportsStored : 0;
+  header.num_sections = table.size();
+  header.table_checksum = checksum(reinterpret_cast<const char*>(table.data()),
+                                   table.size() * sizeof(Section));
+
+  static const char kZeros[kAlign] = {};
+  size_t pos = io::write_pod(out, header);
+  for (auto& s : table)
+    pos += io::write_pod(out, s);
+  for (size_t i = 0; i < table.size(); i++) {
+    out.write(kZeros, table[i].offset - pos);
+    auto& data = sections_[i].second;
+    out.write(data.data(), data.size());
+    pos = table[i].offset + data.size();
+  }
+  return pos;
+}
+
+inline MappedFile::MappedFile(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1)
+    throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    int e = errno;
+    close(fd);
+    throw std::system_error(e, std::generic_category(), "Cannot stat " + path);
+  }
+  size_ = st.st_size;
+  if (size_ > 0)
+    data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  int e = errno;
+  close(fd);
+  if (size_ > 0 and data_ == MAP_FAILED)
+    throw std::system_error(e, std::generic_category(), "Cannot map " + path);
+}
+
+inline void Reader::_read_table(std::istream& in) {
+  io::read_pod(in, header_);
+  if (std::memcmp(header_.magic, kMagic, sizeof(kMagic)) != 0)
+    throw std::runtime_error("Not a trie image.");
+  if (header_.version != kVersion)
+    throw std::runtime_error("Unsupported trie image version " + std::to_string(header_.version) + ".");
+  if (header_.num_sections > kMaxSections)
+    throw std::runtime_error("Trie image has " + std::to_string(header_.num_sections) + " sections.");
+  table_.resize(header_.num_sections);
+  for (auto& s : table_)
+    io::read_pod(in, s);
+  if (checksum(reinterpret_cast<const char*>(table_.data()), table_.size() * sizeof(Section))
+      != header_.table_checksum)
+    throw std::runtime_error("Trie image section table is corrupt.");
+}
+
+inline Reader::Reader(std::istream& in) : in_(&in), base_(in.tellg()) {
+  _read_table(in);
+}
+
+inline Reader::Reader(const char* data, size_t size) : data_(data), size_(size) {
+  MemoryBuffer buffer(data, size);
+  std::istream is(&buffer);
+  _read_table(is);
+}
+
+template<typename F>
+void Reader::section(std::string_view name, F&& f) {
+  auto s = _find(name);
+  if (!s)
+    throw std::runtime_error("Trie image has no section " + std::string(name) + ".");
+  const char* p;
+  std::string data;
+  if (data_) {
+    if (s->offset > size_ or s->size > size_ - s->offset)
+      throw std::runtime_error("Trie image is truncated.");
+    p = data_ + s->offset;
+  } else {
+    in_->clear();
+    if (!in_->seekg(base_ + std::streamoff(s->offset)))
+      throw std::runtime_error("Trie image is truncated.");
+    for (uint64_t m = 0; m < s->size; ) {
+      auto next = std::min<uint64_t>(s->size, std::max<uint64_t>(2 * m, io::kChunk));
+      data.resize(next);
+      io::read_bytes(*in_, data.data() + m, next - m);
+      m = next;
+    }
+    p = data.data();
+  }
+  if (checksum(p, s->size) != s->checksum)
+    throw std::runtime_error("Trie image section " + std::string(name) + " is corrupt.");
+
+  MemoryBuffer buffer(p, s->size);
+  std::istream is(&buffer);
+  f(is);
+}
+
+// Write trie as an image, with or without its rank/select and BpSupport.
+template<typename T>
+size_t save(const T& trie, std::ostream& out, Supports supports = Supports::kRebuild) {
+  Writer w(supports);
+  trie.write_image(w);
+  return w.write(out);
+}
+
+template<typename T>
+void load(T& trie, Reader& r) {
+  trie.read_image(r);
+}
+template<typename T>
+void load(T& trie, std::istream& in) {
+  Reader r(in);
+  load(trie, r);
+}
+
+// Load the image file at path through a read-only mapping
+template<typename T>
+void load_file(T& trie, const std::string& path) {
+  MappedFile file(path);
+  Reader r(file.data(), file.size());
+  load(trie, r);
+}
+
+} // namespace image
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__IMAGE_HPP_
@@ -0,0 +1,136 @@
+#ifndef SUCCINCT_TRIES__IO_HPP_
+#define SUCCINCT_TRIES__IO_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <algorithm>
+
+#include <sdsl/int_vector.hpp>
+
+namespace strie {
+namespace io {
+
+// Raw little helpers for trie images. Values are written in host byte order.
+//
+// Lengths in images are not trusted: vectors grow by at most kChunk bytes
+// past what was read, so a corrupt length fails as truncation instead of
+// allocating it.
+constexpr size_t kChunk = 1ull << 20;
+
+inline void read_bytes(std::istream& in, char* p, size_t n) {
+  if (!in.read(p, n))
+    throw std::runtime_error("Trie image is truncated.");
+}
+
+template<typename T>
+size_t write_pod(std::ostream& out, const T& x) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  out.write(reinterpret_cast<const char*>(&x), sizeof(T));
+  return sizeof(T);
+}
+
+template<typename T>
+void read_pod(std::istream& in, T& x) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  read_bytes(in, reinterpret_cast<char*>(&x), sizeof(T));
+}
+
+// Length and elements of a vector of trivially copyable values
+template<typename V>
+size_t write_vector(std::ostream& out, const V& v) {
+  using T = typename V::value_type;
+  uint64_t n = v.size();
+  write_pod(out, n);
+  out.write(reinterpret_cast<const char*>(v.data()), n * sizeof(T));
+  return sizeof(n) + n * sizeof(T);
+}
+
+template<typename V>
+void read_vector(std::istream& in, V& v) {
+  using T = typename V::value_type;
+  static_assert(std::is_trivially_copyable_v<T>);
+  uint64_t n;
+  read_pod(in, n);
+  v.clear();
+  for (uint64_t m = 0; m < n; ) {
+    auto next = std::min<uint64_t>(n, std::max<uint64_t>(2 * m, kChunk / sizeof(T)));
+    v.resize(next);
+    read_bytes(in, reinterpret_cast<char*>(v.data() + m), (next - m) * sizeof(T));
+    m = next;
+  }
+}
+
+inline size_t write_strings(std::ostream& out, const std::vector<std::string>& v) {
+  size_t bytes = write_pod(out, uint64_t(v.size()));
+  for (auto& s : v)
+    bytes += write_vector(out, s);
+  return bytes;
+}
+
+inline void read_strings(std::istream& in, std::vector<std::string>& v) {
+  uint64_t n;
+  read_pod(in, n);
+  v.clear();
+  for (uint64_t i = 0; i < n; i++)
+    read_vector(in, v.emplace_back());
+}
+
+// sdsl int_vectors as length in bits and width, zero padded to
+// kIntVectorHeader bytes, then words. Words of a vector at the start of an
+// image section are thus 64-byte aligned, in the file and when mapped.
+constexpr size_t kIntVectorHeader = 64;
+
+template<uint8_t W>
+size_t write_int_vector(std::ostream& out, const sdsl::int_vector<W>& v) {
+  static const char kZeros[kIntVectorHeader] = {};
+  uint64_t bits = v.bit_size();
+  uint8_t width = v.width();
+  size_t words = (bits + 63) / 64;
+  write_pod(out, bits);
+  write_pod(out, width);
+  out.write(kZeros, kIntVectorHeader - sizeof(bits) - sizeof(width));
+  out.write(reinterpret_cast<const char*>(v.data()), words * 8);
+  return kIntVectorHeader + words * 8;
+}
+
+template<uint8_t W>
+void read_int_vector(std::istream& in, sdsl::int_vector<W>& v) {
+  uint64_t bits;
+  uint8_t width;
+  char padding[kIntVectorHeader - sizeof(bits) - sizeof(width)];
+  read_pod(in, bits);
+  read_pod(in, width);
+  read_bytes(in, padding, sizeof(padding));
+  if (width == 0 or width > 64 or (W != 0 and width != W))
+    throw std::runtime_error("Trie image has an int_vector of width " + std::to_string(width) + ".");
+  v = sdsl::int_vector<W>();
+  v.width(width);
+  uint64_t words = (bits + 63) / 64;
+  for (uint64_t m = 0; m < words; ) {
+    auto next = std::min<uint64_t>(words, std::max<uint64_t>(2 * m, kChunk / 8));
+    v.bit_resize(next * 64);
+    read_bytes(in, reinterpret_cast<char*>(v.data() + m), (next - m) * 8);
+    m = next;
+  }
+  v.bit_resize(bits);
+}
+
+// sdsl structures by their own load, e.g. rank/select supports given
+// their bit vector. Their lengths are unchecked, so they belong in
+// checksummed sections of image.hpp.
+template<typename S, typename... Args>
+void read_support(std::istream& in, S& s, Args... args) {
+  s.load(in, args...);
+  if (!in)
+    throw std::runtime_error("Trie image is truncated.");
+}
+
+} // namespace io
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__IO_HPP_
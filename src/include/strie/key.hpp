@@ -0,0 +1,38 @@
+#ifndef SUCCINCT_TRIES__KEY_HPP_
+#define SUCCINCT_TRIES__KEY_HPP_
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace strie {
+
+// Keys given to builds are anything convertible to std::string_view
+// (std::string, std::string_view, const char*), or (pointer, length) pairs
+// of bytes, e.g. into an mmapped file. Builds read them through key_view and
+// never copy the bytes, so the keys must outlive the build.
+
+template<typename K>
+struct is_byte_range_pair : std::false_type {};
+template<typename P, typename N>
+struct is_byte_range_pair<std::pair<P, N>>
+    : std::bool_constant<std::is_pointer_v<P> and sizeof(std::remove_pointer_t<P>) == 1
+                         and std::is_integral_v<N>> {};
+
+template<typename K>
+inline constexpr bool is_key_v =
+    std::is_convertible_v<const K&, std::string_view> or is_byte_range_pair<K>::value;
+
+template<typename K>
+std::string_view key_view(const K& key) {
+  static_assert(is_key_v<K>);
+  if constexpr (is_byte_range_pair<K>::value)
+    return std::string_view(reinterpret_cast<const char*>(key.first), key.second);
+  else
+    return key;
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__KEY_HPP_
@@ -11,8 +11,17 @@
 #include <vector>
 #include <queue>
 #include <tuple>
+#include <utility>
 #include <initializer_list>
 #include <iostream>
+#include <limits>
+
+#include "build_stats.hpp"
+#include "hugepage.hpp"
+#include "image.hpp"
+#include "io.hpp"
+#include "key.hpp"
+#include "rank_select.hpp"
 
 #include <sdsl/int_vector.hpp>
 #include <sdsl/rank_support.hpp>
@@ -21,7 +30,8 @@
 
 namespace strie {
 
-class Louds {
+template<typename RankSelect = DefaultRankSelect>
+class BasicLouds {
  public:
   using value_type = std::string;
   using char_type = char;
@@ -29,18 +39,27 @@ class Louds {
   static constexpr char_type kDelim = '\0';
   static constexpr char_type kRootLabel = '^'; // for visualization
   using index_type = size_t;
- private:
+ protected:
+  static constexpr index_type INVALID = std::numeric_limits<index_type>::max();
   sdsl::bit_vector bv_;
-  sdsl::rank_support_v<1, 1> rank1_;
-  sdsl::select_support_mcl<0, 1> select0_;
+  typename RankSelect::template rank_type<1> rank1_;
+  typename RankSelect::template select_type<0> select0_;
   sdsl::bit_vector leaf_;
-  sdsl::rank_support_v<1, 1> rank_leaf_;
-  std::vector<char_type> chars_;
+  typename RankSelect::template rank_type<1> rank_leaf_;
+  hugepage_vector<char_type> chars_;
   size_t size_;
+  BuildStats stats_;
 
- private:
+ protected:
+  // on_leaf(i) is called for each key with its input index i, in leaf order.
+  template<typename It, typename LeafFn>
+  void _build(It begin, It end, LeafFn on_leaf);
   template<typename It>
-  void _build(It begin, It end);
+  void _build(It begin, It end) {
+    _build(begin, end, [](size_t) {});
+  }
+  // Rank/select supports, read from r if it stores them, built otherwise
+  void _init_supports(image::Reader* r = nullptr);
 
   template<typename It>
   void _check_valid_input(It begin, It end) const {
@@ -48,7 +67,7 @@ class Louds {
     if (begin == end)
       return;
     for (auto pre = begin, it = std::next(begin); it != end; ++pre, ++it)
-      if (not (*pre < *it))
+      if (not (key_view(*pre) < key_view(*it)))
         throw std::domain_error("Input string collection is not sorted.");
   }
 
@@ -60,16 +79,31 @@ class Louds {
     return select0_(rank1_(i) + 1);
   }
 
+  // Node reached by reading key[k..len) from node idx, or INVALID
+  template<typename STR>
+  index_type _traverse(const STR& key, index_type len, index_type idx = 1, index_type k = 0) const;
+
+  bool _is_leaf(index_type idx) const {
+    return leaf_[_rank0(idx)];
+  }
+
+  // Rank of the key ending at node idx among the leaves
+  index_type _leaf_rank(index_type idx) const {
+    return rank_leaf_(_rank0(idx));
+  }
+
  public:
-  Louds() : size_(0) {}
+  BasicLouds() : size_(0) {}
   template<typename It>
-  Louds(It begin, It end) : Louds() {
+  BasicLouds(It begin, It end) : BasicLouds() {
     _build(begin, end);
   }
-  Louds(std::initializer_list<value_type> list) : Louds(list.begin(), list.end()) {}
+  BasicLouds(std::initializer_list<value_type> list) : BasicLouds(list.begin(), list.end()) {}
 
   size_t size() const { return size_; }
   bool empty() const { return size() == 0; }
+  // Phases of the build of this trie
+  const BuildStats& build_stats() const { return stats_; }
 
   template<typename STR>
   bool contains(STR&& key, index_type len) const;
@@ -77,6 +111,14 @@ class Louds {
   bool contains(std::string_view key) const { return contains(key, key.length()); }
   bool contains(const char* key) const { return contains(key, std::strlen(key)); }
 
+  // Call f(key) for every key in sorted order.
+  template<typename F>
+  void for_each(F&& f) const;
+
+  // Sections of a versioned image (image::save and image::load)
+  void write_image(image::Writer& w) const;
+  void read_image(image::Reader& r);
+
  public:
   void print_for_debug() const {
     for (int i = 0; i < bv_.size(); i++)
@@ -104,73 +146,152 @@ class Louds {
 
 };
 
-template<typename It>
-void Louds::_build(It begin, It end) {
+template<typename RankSelect>
+template<typename It, typename LeafFn>
+void BasicLouds<RankSelect>::_build(It begin, It end, LeafFn on_leaf) {
   using traits = std::iterator_traits<It>;
-  static_assert(std::is_convertible_v<typename traits::value_type, value_type>);
+  static_assert(is_key_v<typename traits::value_type>);
   static_assert(std::is_base_of_v<std::forward_iterator_tag, typename traits::iterator_category>);
 
+  stats_.start();
   _check_valid_input(begin, end);
+  stats_.mark("validate");
+
+  // n nodes take 2n bits: the root's 1, and a 0 and a 1 per child for each node.
+  auto n = count_trie_nodes(begin, end);
+  stats_.num_nodes = n;
+  bv_ = sdsl::bit_vector(2 * n, 0);
+  leaf_ = sdsl::bit_vector(n, 0);
+  // One more kDelim ends the label scan of _traverse in the last node.
+  chars_.assign(2 * n + 1, kDelim);
+  stats_.mark("count");
 
-  bv_.resize(1);
   bv_[0] = 1;
-  chars_.resize(1);
   chars_[0] = kRootLabel;
-  std::queue<std::tuple<It, It, size_t>> qs;
-  qs.emplace(begin, end, 0);
-  std::vector<char_type> cs;
+  size_t t = 1, l = 0;
+  std::queue<std::tuple<It, It, size_t, size_t>> qs;
+  qs.emplace(begin, end, 0, 0);
   while (!qs.empty()) {
-    auto [b,e,d] = qs.front(); qs.pop();
+    auto [b,e,d,o] = qs.front(); qs.pop();
     assert(b != e);
-    cs.clear();
     bool has_leaf = false;
     auto it = b;
-    if ((*b).size() == d) {
+    if (key_view(*b).size() == d) {
       has_leaf = true;
+      on_leaf(o);
       ++it;
+      ++o;
     }
+    t++; // 0 of the node
     while (it != e) {
       auto f = it++;
-      assert(f->length() > d);
-      auto c = (*f)[d];
-      cs.push_back(c);
-      while (it != e and (*it)[d] == c)
+      auto fo = o++;
+      assert(key_view(*f).length() > d);
+      auto c = key_view(*f)[d];
+      bv_[t] = 1;
+      chars_[t++] = c;
+      while (it != e and key_view(*it)[d] == c) {
         ++it;
-      qs.emplace(f, it, d+1);
+        ++o;
+      }
+      qs.emplace(f, it, d+1, fo);
     }
-    size_t t = bv_.size();
-    bv_.resize(t + 1 + cs.size());
-    bv_[t] = 0;
-    chars_.resize(t + 1 + cs.size());
-    chars_[t] = kDelim;
-    for (int i = 0; i < cs.size(); i++) {
-      bv_[t + 1 + i] = 1;
-      chars_[t + 1 + i] = cs[i];
-    }
-    leaf_.resize(leaf_.size()+1);
-    leaf_[leaf_.size()-1] = has_leaf;
+    leaf_[l++] = has_leaf;
+  }
+  assert(t == bv_.size() and l == leaf_.size());
+  stats_.mark("traverse", sdsl::size_in_bytes(bv_) + sdsl::size_in_bytes(leaf_) + chars_.size());
+
+  _init_supports();
+}
+
+template<typename RankSelect>
+void BasicLouds<RankSelect>::_init_supports(image::Reader* r) {
+  if (r and r->stores_supports(image::rank_select_id_v<RankSelect>)) {
+    r->section("rank1", [&](std::istream& in) { io::read_support(in, rank1_, &bv_); });
+    r->section("select0", [&](std::istream& in) { io::read_support(in, select0_, &bv_); });
+    r->section("rank_leaf", [&](std::istream& in) { io::read_support(in, rank_leaf_, &leaf_); });
+  } else {
+    sdsl::util::init_support(rank1_, &bv_);
+    sdsl::util::init_support(select0_, &bv_);
+    sdsl::util::init_support(rank_leaf_, &leaf_);
   }
-  sdsl::util::init_support(rank1_, &bv_);
-  sdsl::util::init_support(select0_, &bv_);
-  sdsl::util::init_support(rank_leaf_, &leaf_);
   size_ = rank_leaf_(leaf_.size());
+  hugepages::advise(bv_);
+  hugepages::advise(leaf_);
+  stats_.mark("rank_select", sdsl::size_in_bytes(rank1_) + sdsl::size_in_bytes(select0_)
+                             + sdsl::size_in_bytes(rank_leaf_));
+}
+
+template<typename RankSelect>
+void BasicLouds<RankSelect>::write_image(image::Writer& w) const {
+  w.begin(image::Type::kLouds, image::rank_select_id_v<RankSelect>);
+  w.section("bv", [&](std::ostream& out) { io::write_int_vector(out, bv_); });
+  w.section("leaf", [&](std::ostream& out) { io::write_int_vector(out, leaf_); });
+  w.section("chars", [&](std::ostream& out) { io::write_vector(out, chars_); });
+  if (w.stores_supports()) {
+    w.section("rank1", [&](std::ostream& out) { rank1_.serialize(out); });
+    w.section("select0", [&](std::ostream& out) { select0_.serialize(out); });
+    w.section("rank_leaf", [&](std::ostream& out) { rank_leaf_.serialize(out); });
+  }
+}
+
+template<typename RankSelect>
+void BasicLouds<RankSelect>::read_image(image::Reader& r) {
+  r.expect(image::Type::kLouds);
+  stats_.start();
+  r.section("bv", [&](std::istream& in) { io::read_int_vector(in, bv_); });
+  r.section("leaf", [&](std::istream& in) { io::read_int_vector(in, leaf_); });
+  r.section("chars", [&](std::istream& in) { io::read_vector(in, chars_); });
+  stats_.num_nodes = leaf_.size();
+  stats_.mark("load", sdsl::size_in_bytes(bv_) + sdsl::size_in_bytes(leaf_) + chars_.size());
+  _init_supports(&r);
 }
 
+template<typename RankSelect>
 template<typename STR>
-bool Louds::contains(STR&& key, index_type len) const {
-  index_type i, idx = 1;
-  for (i = 0; i < len; i++) {
+typename BasicLouds<RankSelect>::index_type
+BasicLouds<RankSelect>::_traverse(const STR& key, index_type len, index_type idx, index_type k) const {
+  for (auto i = k; i < len; i++) {
     idx++;
     char_type c;
-    while ((c = chars_[idx]) != kDelim and c < key[i])
+    while ((c = chars_[idx]) != kDelim and (unsigned char) c < (unsigned char) key[i])
       ++idx;
     if (c != key[i])
-      return false;
+      return INVALID;
     idx = _child(idx);
   }
-  return leaf_[_rank0(idx)];
+  return idx;
 }
 
+template<typename RankSelect>
+template<typename STR>
+bool BasicLouds<RankSelect>::contains(STR&& key, index_type len) const {
+  auto idx = _traverse(key, len);
+  return idx != INVALID and _is_leaf(idx);
+}
+
+template<typename RankSelect>
+template<typename F>
+void BasicLouds<RankSelect>::for_each(F&& f) const {
+  if (empty())
+    return;
+  value_type key;
+  auto dfs = [&](auto& g, index_type idx) -> void {
+    if (leaf_[_rank0(idx)])
+      f(std::as_const(key));
+    for (auto i = idx + 1; i < bv_.size() and bv_[i]; i++) {
+      key.push_back(chars_[i]);
+      g(g, _child(i));
+      key.pop_back();
+    }
+  };
+  dfs(dfs, 1);
+}
+
+using Louds = BasicLouds<>;
+using FastLouds = BasicLouds<FastRankSelect>;
+using SmallLouds = BasicLouds<SmallRankSelect>;
+
 } // namespace strie
 
 #endif //SUCCINCT_TRIES__LOUDS_HPP_
@@ -0,0 +1,417 @@
+#ifndef SUCCINCT_TRIES__LOUDS_FILTER_HPP_
+#define SUCCINCT_TRIES__LOUDS_FILTER_HPP_
+
+#include "key.hpp"
+#include "rank_select.hpp"
+
+#include <string>
+#include <string_view>
+#include <iterator>
+#include <type_traits>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <sdsl/int_vector.hpp>
+#include <sdsl/rank_support.hpp>
+#include <sdsl/util.hpp>
+
+namespace strie {
+
+// Approximate membership and range filter (SuRF) on a truncated LOUDS.
+// Each key is cut after the byte distinguishing it from its neighbours, and
+// its leaf keeps `suffix_bits` bits of either a hash of the whole key
+// (point queries) or the key bytes following the cut (point and range queries).
+// There are no false negatives; false positives get rarer with suffix_bits.
+//
+// Labels are codes of the bytes the keys use. The upper levels are dense, a
+// bitmap of the alphabet per node; the lower ones sparse, a code and a LOUDS
+// bit per label. The split is the level that minimizes the size. Every label
+// has a has-child bit, every internal node a bit telling whether its path is
+// a key, and there are no per-node delimiters.
+class LoudsFilter {
+ public:
+  using index_type = uint64_t;
+  enum class Suffix { kNone, kHash, kReal };
+  static constexpr index_type INVALID = std::numeric_limits<index_type>::max();
+ private:
+  Suffix suffix_type_ = Suffix::kNone;
+  unsigned suffix_bits_ = 0;
+  size_t num_keys_ = 0;
+
+  // Alphabet: byte of each code, and number of codes below each byte
+  std::vector<uint8_t> symbols_;
+  std::array<uint16_t, 256> ceil_{};
+
+  // Internal nodes are numbered in level order from the root, 0, and labels
+  // likewise; dense ones come first. The child of label e is internal node
+  // rank1(has_child, e) + 1.
+  size_t dense_levels_ = 0;
+  index_type num_dense_nodes_ = 0;
+  index_type num_dense_labels_ = 0;
+  sdsl::bit_vector d_labels_;   // symbols_.size() bits per dense node
+  sdsl::rank_support_v5<1, 1> d_rank_;
+  sdsl::int_vector<> s_labels_;
+  sdsl::bit_vector s_louds_;    // first label of each sparse node
+  SampledSelect<1, 64> s_select_;
+  sdsl::bit_vector has_child_;
+  sdsl::rank_support_v5<1, 1> child_rank_;
+  sdsl::bit_vector prefix_key_; // internal node whose path is a key
+  sdsl::int_vector<> suffixes_; // of the leaves, by label order
+
+  static uint64_t _hash(std::string_view key) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (unsigned char c : key)
+      h = (h ^ c) * 0x100000001b3ull;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return h;
+  }
+
+  // First `bits` bits of key[pos..], zero padded.
+  static uint64_t _real_suffix(std::string_view key, size_t pos, unsigned bits) {
+    uint64_t s = 0;
+    for (unsigned b = 0; b < bits; b += 8) {
+      uint64_t c = pos + b/8 < key.length() ? (unsigned char) key[pos + b/8] : 0;
+      s = (s << 8) | c;
+    }
+    return s >> ((8 - bits % 8) % 8);
+  }
+
+  uint64_t _suffix(std::string_view key, size_t pos) const {
+    switch (suffix_type_) {
+      case Suffix::kHash: return _hash(key) & sdsl::bits::lo_set[suffix_bits_];
+      case Suffix::kReal: return _real_suffix(key, pos, suffix_bits_);
+      default: return 0;
+    }
+  }
+
+  uint64_t _leaf_suffix(index_type e) const {
+    return suffix_bits_ ? suffixes_[e - child_rank_(e)] : 0;
+  }
+
+  index_type _child(index_type e) const {
+    return child_rank_(e) + 1;
+  }
+
+  // Least code of a byte at least c, the alphabet size if there is none
+  unsigned _code_ceil(unsigned char c) const {
+    return ceil_[c];
+  }
+
+  bool _is_code(unsigned code, unsigned char c) const {
+    return code < symbols_.size() and symbols_[code] == c;
+  }
+
+  // Label of node with the least code at least `code`, and that code; INVALID
+  // if there is none
+  index_type _lower_label(index_type node, unsigned code, unsigned& found) const;
+
+  struct Found {
+    index_type at;  // leaf label, or internal node
+    bool leaf;
+  };
+  // Leaf of the smallest key that may be at least lo, with its path; at is
+  // INVALID if there is none.
+  Found _lower_bound(std::string_view lo, std::string& path) const;
+
+ public:
+  LoudsFilter() = default;
+  template<typename It>
+  LoudsFilter(It begin, It end, Suffix suffix_type = Suffix::kReal, unsigned suffix_bits = 8) {
+    build(begin, end, suffix_type, suffix_bits);
+  }
+  LoudsFilter(const LoudsFilter&) = delete;
+  LoudsFilter& operator=(const LoudsFilter&) = delete;
+
+  template<typename It>
+  void build(It begin, It end, Suffix suffix_type = Suffix::kReal, unsigned suffix_bits = 8);
+
+  size_t size() const { return num_keys_; }
+  bool empty() const { return size() == 0; }
+
+  bool may_contain(std::string_view key) const;
+
+  // Whether a key in [lo, hi] may exist.
+  bool may_contain_range(std::string_view lo, std::string_view hi) const;
+
+  // Levels stored dense, from the root
+  size_t dense_levels() const { return dense_levels_; }
+
+  size_t size_in_bytes() const {
+    return symbols_.size() + sizeof(ceil_)
+        + sdsl::size_in_bytes(d_labels_) + sdsl::size_in_bytes(d_rank_)
+        + sdsl::size_in_bytes(s_labels_) + sdsl::size_in_bytes(s_louds_) + sdsl::size_in_bytes(s_select_)
+        + sdsl::size_in_bytes(has_child_) + sdsl::size_in_bytes(child_rank_)
+        + sdsl::size_in_bytes(prefix_key_) + sdsl::size_in_bytes(suffixes_);
+  }
+  double bits_per_key() const { return empty() ? 0 : 8.0 * size_in_bytes() / size(); }
+};
+
+template<typename It>
+void LoudsFilter::build(It begin, It end, Suffix suffix_type, unsigned suffix_bits) {
+  using traits = std::iterator_traits<It>;
+  static_assert(is_key_v<typename traits::value_type>);
+  assert(suffix_bits <= 64);
+  suffix_type_ = suffix_type;
+  suffix_bits_ = suffix_type == Suffix::kNone ? 0 : suffix_bits;
+
+  std::vector<std::string_view> keys;
+  for (auto it = begin; it != end; ++it)
+    keys.push_back(key_view(*it));
+  for (size_t i = 1; i < keys.size(); i++)
+    if (not (keys[i-1] < keys[i]))
+      throw std::domain_error("Input string collection is not sorted.");
+  num_keys_ = keys.size();
+
+  // Minimum distinguishing prefixes
+  auto lcp = [](std::string_view a, std::string_view b) {
+    return size_t(std::mismatch(a.begin(), a.begin() + std::min(a.size(), b.size()), b.begin()).first - a.begin());
+  };
+  std::vector<size_t> cut(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    size_t l = 0;
+    if (i > 0)
+      l = std::max(l, lcp(keys[i-1], keys[i]));
+    if (i+1 < keys.size())
+      l = std::max(l, lcp(keys[i], keys[i+1]));
+    cut[i] = std::min(keys[i].size(), l + 1);
+  }
+
+  // Level order of the truncated trie. An internal node at depth d is the
+  // range of keys sharing its path; each label of it, the keys below.
+  struct Level {
+    std::vector<uint8_t> labels;
+    std::vector<bool> has_child;
+    std::vector<size_t> degree;       // of each internal node
+    std::vector<bool> prefix_key;
+  };
+  std::vector<Level> levels;
+  std::vector<uint64_t> leaf_suffixes;
+  std::array<bool, 256> used{};
+  struct Range { size_t b, e; };
+  std::vector<Range> nodes, next;
+  if (!keys.empty())
+    nodes.push_back({0, keys.size()});
+  for (size_t d = 0; !nodes.empty(); d++) {
+    auto& level = levels.emplace_back();
+    next.clear();
+    for (auto [b, e] : nodes) {
+      bool is_key = cut[b] == d;
+      level.prefix_key.push_back(is_key);
+      b += is_key;
+      size_t degree = 0;
+      for (auto g = b; g < e; degree++) {
+        auto c = (uint8_t) keys[g][d];
+        auto h = g + 1;
+        while (h < e and (uint8_t) keys[h][d] == c)
+          h++;
+        used[c] = true;
+        level.labels.push_back(c);
+        bool internal = h - g > 1 or cut[g] > d + 1;
+        level.has_child.push_back(internal);
+        if (internal)
+          next.push_back({g, h});
+        else
+          leaf_suffixes.push_back(_suffix(keys[g], cut[g]));
+        g = h;
+      }
+      level.degree.push_back(degree);
+    }
+    std::swap(nodes, next);
+  }
+
+  symbols_.clear();
+  for (unsigned c = 0; c < 256; c++) {
+    ceil_[c] = symbols_.size();
+    if (used[c])
+      symbols_.push_back(c);
+  }
+  size_t sigma = std::max<size_t>(symbols_.size(), 1);
+  unsigned width = sdsl::bits::hi(sigma - 1) + 1;
+
+  // Dense levels [0, dense_levels_) where bitmaps beat codes and LOUDS bits
+  double best = 0, cost = 0;
+  dense_levels_ = 0;
+  for (size_t l = 0; l < levels.size(); l++) {
+    cost += levels[l].degree.size() * sigma * (1 + 1.0 / 16)
+        - levels[l].labels.size() * (width + 1.0);
+    if (cost < best) {
+      best = cost;
+      dense_levels_ = l + 1;
+    }
+  }
+
+  size_t num_nodes = 0, num_labels = 0;
+  num_dense_nodes_ = num_dense_labels_ = 0;
+  for (size_t l = 0; l < levels.size(); l++) {
+    num_nodes += levels[l].degree.size();
+    num_labels += levels[l].labels.size();
+    if (l + 1 == dense_levels_) {
+      num_dense_nodes_ = num_nodes;
+      num_dense_labels_ = num_labels;
+    }
+  }
+  d_labels_ = sdsl::bit_vector(num_dense_nodes_ * symbols_.size(), 0);
+  s_labels_ = sdsl::int_vector<>(num_labels - num_dense_labels_, 0, width);
+  s_louds_ = sdsl::bit_vector(num_labels - num_dense_labels_, 0);
+  has_child_ = sdsl::bit_vector(num_labels, 0);
+  prefix_key_ = sdsl::bit_vector(num_nodes, 0);
+  size_t node = 0, label = 0;
+  for (size_t l = 0; l < levels.size(); l++) {
+    auto& level = levels[l];
+    size_t i = 0;
+    for (size_t j = 0; j < level.degree.size(); j++, node++) {
+      prefix_key_[node] = level.prefix_key[j];
+      for (size_t k = 0; k < level.degree[j]; k++, i++, label++) {
+        unsigned code = ceil_[level.labels[i]];
+        has_child_[label] = level.has_child[i];
+        if (l < dense_levels_) {
+          d_labels_[node * symbols_.size() + code] = 1;
+        } else {
+          s_labels_[label - num_dense_labels_] = code;
+          s_louds_[label - num_dense_labels_] = k == 0;
+        }
+      }
+    }
+  }
+  suffixes_ = sdsl::int_vector<>(suffix_bits_ ? leaf_suffixes.size() : 0, 0, std::max(1u, suffix_bits_));
+  for (size_t i = 0; i < suffixes_.size(); i++)
+    suffixes_[i] = leaf_suffixes[i];
+
+  sdsl::util::init_support(d_rank_, &d_labels_);
+  sdsl::util::init_support(s_select_, &s_louds_);
+  sdsl::util::init_support(child_rank_, &has_child_);
+}
+
+inline LoudsFilter::index_type
+LoudsFilter::_lower_label(index_type node, unsigned code, unsigned& found) const {
+  size_t sigma = symbols_.size();
+  if (node < num_dense_nodes_) {
+    auto base = node * sigma;
+    for (auto p = base + code; p < base + sigma; p++) {
+      if (d_labels_[p]) {
+        found = p - base;
+        return d_rank_(p);
+      }
+    }
+    return INVALID;
+  }
+  if (s_louds_.empty())
+    return INVALID;
+  auto e = s_select_(node - num_dense_nodes_ + 1);
+  do {
+    if (s_labels_[e] >= code) {
+      found = s_labels_[e];
+      return num_dense_labels_ + e;
+    }
+    e++;
+  } while (e < s_louds_.size() and !s_louds_[e]);
+  return INVALID;
+}
+
+inline bool LoudsFilter::may_contain(std::string_view key) const {
+  if (empty())
+    return false;
+  index_type node = 0;
+  for (size_t d = 0; ; d++) {
+    if (d == key.length())
+      return prefix_key_[node];
+    auto code = _code_ceil(key[d]);
+    if (!_is_code(code, key[d]))
+      return false;
+    unsigned found;
+    auto e = _lower_label(node, code, found);
+    if (e == INVALID or found != code)
+      return false;
+    if (!has_child_[e]) // cut leaf
+      return _leaf_suffix(e) == _suffix(key, d + 1);
+    node = _child(e);
+  }
+}
+
+inline LoudsFilter::Found
+LoudsFilter::_lower_bound(std::string_view lo, std::string& path) const {
+  struct Step { index_type node; unsigned code; };
+  std::vector<Step> stack; // labels of path
+  index_type node = 0;
+  path.clear();
+  auto push = [&](index_type n, unsigned code) {
+    path.push_back(symbols_[code]);
+    stack.push_back({n, code});
+  };
+  // Smallest key through label e of node n
+  auto leftmost = [&](index_type n, index_type e, unsigned code) -> Found {
+    push(n, code);
+    while (has_child_[e]) {
+      n = _child(e);
+      if (prefix_key_[n])
+        return {n, false};
+      e = _lower_label(n, 0, code);
+      push(n, code);
+    }
+    return {e, true};
+  };
+  // Smallest key after the subtree of path
+  auto next = [&]() -> Found {
+    while (!stack.empty()) {
+      auto [n, code] = stack.back();
+      stack.pop_back();
+      path.pop_back();
+      unsigned found;
+      auto e = _lower_label(n, code + 1, found);
+      if (e != INVALID)
+        return leftmost(n, e, found);
+    }
+    return {INVALID, false};
+  };
+
+  while (true) {
+    auto d = path.size();
+    unsigned found;
+    if (d == lo.length()) {
+      if (prefix_key_[node])
+        return {node, false};
+      auto e = _lower_label(node, 0, found);
+      return leftmost(node, e, found);
+    }
+    auto code = _code_ceil(lo[d]);
+    auto e = _lower_label(node, code, found);
+    if (e == INVALID)
+      return next();
+    if (found != code or !_is_code(code, lo[d]))
+      return leftmost(node, e, found);
+    push(node, code);
+    if (!has_child_[e]) {
+      if (suffix_type_ == Suffix::kReal and _leaf_suffix(e) < _real_suffix(lo, d + 1, suffix_bits_))
+        return next();
+      return {e, true};
+    }
+    node = _child(e);
+  }
+}
+
+inline bool LoudsFilter::may_contain_range(std::string_view lo, std::string_view hi) const {
+  if (empty() or hi < lo)
+    return false;
+  std::string path;
+  auto [at, leaf] = _lower_bound(lo, path);
+  if (at == INVALID)
+    return false;
+  if (!leaf) // whole key
+    return std::string_view(path) <= hi;
+  if (hi.substr(0, path.length()) != path)
+    return std::string_view(path) < hi;
+  if (suffix_type_ == Suffix::kReal)
+    return _leaf_suffix(at) <= _real_suffix(hi, path.length(), suffix_bits_);
+  return true;
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__LOUDS_FILTER_HPP_
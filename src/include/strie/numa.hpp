@@ -0,0 +1,111 @@
+#ifndef SUCCINCT_TRIES__NUMA_HPP_
+#define SUCCINCT_TRIES__NUMA_HPP_
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <cctype>
+#include <system_error>
+
+namespace strie {
+namespace numa {
+
+struct Node {
+  int id;                // as the OS numbers it, for libnuma or mbind
+  std::vector<int> cpus;
+};
+
+// CPUs of a sysfs cpulist, e.g. "0-3,8,10-11"
+inline std::vector<int> parse_cpulist(const std::string& list) {
+  std::vector<int> cpus;
+  size_t i = 0;
+  auto number = [&] {
+    int x = 0;
+    while (i < list.size() and std::isdigit((unsigned char) list[i]))
+      x = x * 10 + (list[i++] - '0');
+    return x;
+  };
+  while (i < list.size() and std::isdigit((unsigned char) list[i])) {
+    int lo = number(), hi = lo;
+    if (i < list.size() and list[i] == '-') {
+      i++;
+      hi = number();
+    }
+    for (int c = lo; c <= hi; c++)
+      cpus.push_back(c);
+    if (i < list.size() and list[i] == ',')
+      i++;
+  }
+  return cpus;
+}
+
+// CPUs the calling thread may run on, which excludes offline CPUs and those
+// outside its cgroup or taskset
+inline std::vector<int> allowed_cpus() {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) != 0)
+    throw std::system_error(errno, std::generic_category(), "sched_getaffinity");
+  std::vector<int> cpus;
+  for (int c = 0; c < CPU_SETSIZE; c++)
+    if (CPU_ISSET(c, &set))
+      cpus.push_back(c);
+  return cpus;
+}
+
+// NUMA nodes with allowed CPUs, by increasing id, from
+// /sys/devices/system/node/node*/cpulist. Hosts without NUMA information
+// are node 0 of all allowed CPUs.
+inline std::vector<Node> nodes() {
+  namespace fs = std::filesystem;
+  auto allowed = allowed_cpus();
+  std::vector<Node> nodes;
+  std::error_code ec;
+  for (auto& e : fs::directory_iterator("/sys/devices/system/node", ec)) {
+    auto name = e.path().filename().string();
+    if (name.rfind("node", 0) != 0 or name.size() == 4 or !std::isdigit((unsigned char) name[4]))
+      continue;
+    std::ifstream ifs(e.path() / "cpulist");
+    std::string list;
+    std::getline(ifs, list);
+    Node node{std::stoi(name.substr(4)), {}};
+    for (auto c : parse_cpulist(list))
+      if (std::binary_search(allowed.begin(), allowed.end(), c))
+        node.cpus.push_back(c);
+    if (!node.cpus.empty())
+      nodes.push_back(std::move(node));
+  }
+  if (nodes.empty())
+    nodes.push_back({0, allowed});
+  std::sort(nodes.begin(), nodes.end(), [](auto& a, auto& b) { return a.id < b.id; });
+  return nodes;
+}
+
+// Pin the calling thread to the cpus. Memory it first touches afterwards is
+// placed on their node by the kernel's default policy. Throws
+// std::system_error if the thread cannot run there.
+inline void pin(const std::vector<int>& cpus) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (auto c : cpus) {
+    if (c < 0 or c >= CPU_SETSIZE)
+      throw std::system_error(EINVAL, std::generic_category(), "No CPU " + std::to_string(c));
+    CPU_SET(c, &set);
+  }
+  if (int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set); rc != 0)
+    throw std::system_error(rc, std::generic_category(), "pthread_setaffinity_np");
+}
+inline void pin(int cpu) {
+  pin(std::vector<int>{cpu});
+}
+
+} // namespace numa
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__NUMA_HPP_
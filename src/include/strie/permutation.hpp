@@ -0,0 +1,154 @@
+#ifndef SUCCINCT_TRIES__PERMUTATION_HPP_
+#define SUCCINCT_TRIES__PERMUTATION_HPP_
+
+#include <cstdint>
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sdsl/int_vector.hpp>
+#include <sdsl/bits.hpp>
+#include <sdsl/util.hpp>
+
+#include "io.hpp"
+
+namespace strie {
+
+// A permutation of [0, n) in n log n bits, with its inverse by shortcuts on
+// the cycles (Munro, Raman, Raman and Rao): on a cycle longer than kStep,
+// every kStep-th element points kStep elements back. An inverse walks
+// forward to such an element, jumps back once and walks forward to the
+// preimage, at most 2 kStep + 1 steps; the shortcuts add n / kStep log n + n
+// bits.
+template<uint32_t kStep = 16>
+class Permutation {
+  static_assert(kStep > 0);
+
+ public:
+  using size_type = uint64_t;
+
+ private:
+  static constexpr size_type kBlockWords = 4;
+
+  sdsl::int_vector<> pi_;
+  sdsl::bit_vector has_back_;   // elements with a shortcut
+  sdsl::int_vector<> back_;     // their targets, in the order of the elements
+  sdsl::int_vector<> counts_;   // shortcuts before each block of kBlockWords words
+
+  void _count();
+  // Shortcuts before element i
+  size_type _rank(size_type i) const;
+
+ public:
+  Permutation() = default;
+  // pi holds pi(0), ..., pi(n-1).
+  explicit Permutation(sdsl::int_vector<> pi);
+
+  size_type size() const { return pi_.size(); }
+  size_type operator[](size_type i) const { return pi_[i]; }
+  // The i with pi(i) = j
+  size_type inverse(size_type j) const;
+
+  size_type size_in_bytes() const {
+    return sdsl::size_in_bytes(pi_) + sdsl::size_in_bytes(has_back_) + sdsl::size_in_bytes(back_)
+           + sdsl::size_in_bytes(counts_);
+  }
+
+  size_t serialize(std::ostream& out) const;
+  void load(std::istream& in);
+};
+
+template<uint32_t kStep>
+Permutation<kStep>::Permutation(sdsl::int_vector<> pi) : pi_(std::move(pi)) {
+  auto n = pi_.size();
+  sdsl::util::bit_compress(pi_);
+  has_back_ = sdsl::bit_vector(n, 0);
+  sdsl::bit_vector seen(n, 0);
+  std::vector<std::pair<size_type, size_type>> backs;
+  std::vector<size_type> cycle;
+  for (size_type s = 0; s < n; s++) {
+    if (seen[s])
+      continue;
+    cycle.clear();
+    for (auto i = s; !seen[i]; i = pi_[i]) {
+      seen[i] = 1;
+      cycle.push_back(i);
+    }
+    if (cycle.size() <= kStep)
+      continue;
+    for (size_type k = 0; k < cycle.size(); k += kStep) {
+      has_back_[cycle[k]] = 1;
+      backs.emplace_back(cycle[k], cycle[(k + cycle.size() - kStep) % cycle.size()]);
+    }
+  }
+  std::sort(backs.begin(), backs.end());
+  back_ = sdsl::int_vector<>(backs.size(), 0, sdsl::bits::hi(std::max<size_type>(n, 1)) + 1);
+  for (size_type i = 0; i < backs.size(); i++)
+    back_[i] = backs[i].second;
+  _count();
+}
+
+template<uint32_t kStep>
+void Permutation<kStep>::_count() {
+  auto words = (has_back_.size() + 63) / 64;
+  auto blocks = (words + kBlockWords - 1) / kBlockWords;
+  counts_ = sdsl::int_vector<>(blocks + 1, 0, sdsl::bits::hi(std::max<size_type>(back_.size(), 1)) + 1);
+  size_type count = 0;
+  for (size_type w = 0; w < words; w++) {
+    if (w % kBlockWords == 0)
+      counts_[w / kBlockWords] = count;
+    count += sdsl::bits::cnt(has_back_.data()[w]);
+  }
+  counts_[blocks] = count;
+}
+
+template<uint32_t kStep>
+typename Permutation<kStep>::size_type Permutation<kStep>::_rank(size_type i) const {
+  auto w = i / 64;
+  auto data = has_back_.data();
+  size_type r = counts_[w / kBlockWords];
+  for (auto v = w - w % kBlockWords; v < w; v++)
+    r += sdsl::bits::cnt(data[v]);
+  return r + sdsl::bits::cnt(data[w] & ((uint64_t(1) << (i % 64)) - 1));
+}
+
+template<uint32_t kStep>
+typename Permutation<kStep>::size_type Permutation<kStep>::inverse(size_type j) const {
+  auto i = j;
+  bool jumped = false;
+  while (true) {
+    size_type p = pi_[i];
+    if (p == j)
+      return i;
+    if (!jumped and has_back_[i]) {
+      i = back_[_rank(i)];
+      jumped = true;
+    } else {
+      i = p;
+    }
+  }
+}
+
+template<uint32_t kStep>
+size_t Permutation<kStep>::serialize(std::ostream& out) const {
+  return io::write_int_vector(out, pi_) + io::write_int_vector(out, has_back_)
+         + io::write_int_vector(out, back_);
+}
+
+template<uint32_t kStep>
+void Permutation<kStep>::load(std::istream& in) {
+  io::read_int_vector(in, pi_);
+  io::read_int_vector(in, has_back_);
+  io::read_int_vector(in, back_);
+  if (has_back_.size() != pi_.size())
+    throw std::runtime_error("Trie image has a permutation of " + std::to_string(pi_.size())
+                             + " elements with " + std::to_string(has_back_.size()) + " shortcut bits.");
+  _count();
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__PERMUTATION_HPP_
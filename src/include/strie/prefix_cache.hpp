@@ -0,0 +1,144 @@
+#ifndef SUCCINCT_TRIES__PREFIX_CACHE_HPP_
+#define SUCCINCT_TRIES__PREFIX_CACHE_HPP_
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <utility>
+
+#include "key.hpp"
+
+namespace strie {
+
+// Trie (Louds, DfudsTrie, or a Basic* variant of them) with a small table
+// from hot key prefixes of a fixed length to the node they reach, so that
+// lookups of keys under a cached prefix skip the top levels.
+// Prefixes without any key are cached too and answered at once.
+// The table is filled by warm() from sample queries and is read-only
+// afterwards; warm() must not run concurrently with lookups.
+template<typename T>
+class PrefixCachedTrie : public T {
+  using trie = T;
+ public:
+  using trie_type = T;
+  using typename trie::index_type;
+  using typename trie::value_type;
+  static constexpr size_t kMaxPrefix = 16;
+ private:
+  struct Entry {
+    uint64_t prefix[2];
+    index_type node; // INVALID if no key has the prefix
+    bool used;
+  };
+  size_t prefix_len_;
+  std::vector<Entry> table_;
+
+  template<typename STR>
+  void _pack(const STR& key, uint64_t (&w)[2]) const {
+    w[0] = w[1] = 0;
+    for (size_t i = 0; i < prefix_len_; i++)
+      w[i / 8] |= uint64_t((unsigned char) key[i]) << (i % 8 * 8);
+  }
+
+  size_t _slot(const uint64_t (&w)[2]) const {
+    auto h = (w[0] ^ (w[1] * 0x9e3779b97f4a7c15ull)) * 0xff51afd7ed558ccdull;
+    return (h ^ (h >> 29)) & (table_.size() - 1);
+  }
+
+  void _init_table(size_t num_slots) {
+    assert(0 < prefix_len_ and prefix_len_ <= kMaxPrefix);
+    size_t n = 1;
+    while (n < num_slots)
+      n *= 2;
+    table_.assign(n, Entry{{0, 0}, 0, false});
+  }
+
+ public:
+  explicit PrefixCachedTrie(size_t prefix_len = 8, size_t num_slots = 4096)
+      : trie(), prefix_len_(prefix_len) {
+    _init_table(num_slots);
+  }
+  template<typename It>
+  PrefixCachedTrie(It begin, It end, size_t prefix_len = 8, size_t num_slots = 4096)
+      : trie(begin, end), prefix_len_(prefix_len) {
+    _init_table(num_slots);
+  }
+  PrefixCachedTrie(const PrefixCachedTrie&) = delete;
+  PrefixCachedTrie& operator=(const PrefixCachedTrie&) = delete;
+
+  // Cache the prefixes occurring most often among the queries [begin, end).
+  template<typename It>
+  void warm(It begin, It end);
+
+  void clear_cache() {
+    for (auto& e : table_)
+      e.used = false;
+  }
+
+  size_t prefix_length() const { return prefix_len_; }
+  size_t cache_size() const {
+    return std::count_if(table_.begin(), table_.end(), [](auto& e) { return e.used; });
+  }
+
+  template<typename STR>
+  bool contains(STR&& key, index_type len) const;
+  bool contains(const std::string& key) const { return contains(key, key.length()); }
+  bool contains(std::string_view key) const { return contains(key, key.length()); }
+  bool contains(const char* key) const { return contains(key, std::strlen(key)); }
+
+};
+
+template<typename T>
+template<typename It>
+void PrefixCachedTrie<T>::warm(It begin, It end) {
+  // Prefixes are copied: the iterator may yield temporaries.
+  std::unordered_map<std::string, size_t> freq;
+  for (auto it = begin; it != end; ++it) {
+    const auto& k = *it;
+    auto q = key_view(k);
+    if (q.length() >= prefix_len_)
+      ++freq[std::string(q.substr(0, prefix_len_))];
+  }
+  std::vector<std::pair<size_t, std::string_view>> hot;
+  hot.reserve(freq.size());
+  for (auto& [p, c] : freq)
+    hot.emplace_back(c, p);
+  std::sort(hot.begin(), hot.end(), [](auto& a, auto& b) { return a.first > b.first; });
+  // The most frequent prefix of each slot wins.
+  for (auto [c, p] : hot) {
+    Entry e;
+    _pack(p, e.prefix);
+    auto& slot = table_[_slot(e.prefix)];
+    if (slot.used)
+      continue;
+    e.node = trie::_traverse(p, prefix_len_);
+    e.used = true;
+    slot = e;
+  }
+}
+
+template<typename T>
+template<typename STR>
+bool PrefixCachedTrie<T>::contains(STR&& key, index_type len) const {
+  if (len >= prefix_len_) {
+    uint64_t w[2];
+    _pack(key, w);
+    auto& e = table_[_slot(w)];
+    if (e.used and e.prefix[0] == w[0] and e.prefix[1] == w[1]) {
+      if (e.node == trie::INVALID)
+        return false;
+      auto idx = trie::_traverse(key, len, e.node, prefix_len_);
+      return idx != trie::INVALID and trie::_is_leaf(idx);
+    }
+  }
+  return trie::contains(key, len);
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__PREFIX_CACHE_HPP_
@@ -0,0 +1,149 @@
+#ifndef SUCCINCT_TRIES__RANK_SELECT_HPP_
+#define SUCCINCT_TRIES__RANK_SELECT_HPP_
+
+#include "bp.hpp"
+
+#include <cstdint>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sdsl/bit_vectors.hpp>
+#include <sdsl/rank_support.hpp>
+#include <sdsl/select_support.hpp>
+
+namespace strie {
+
+// Select of B bits from the position of every kRate-th of them and a popcount
+// scan of the words that follow, with log(size) bits per sample. A rate of 128
+// takes about the space of select_support_mcl and saves one of its cache
+// misses on long vectors; 1024 takes a tenth of it for a longer scan.
+template<uint8_t B, uint32_t kRate>
+class SampledSelect {
+  static_assert(B <= 1 and kRate > 0);
+
+ public:
+  using size_type = sdsl::bit_vector::size_type;
+
+ private:
+  const sdsl::bit_vector* bv_ = nullptr;
+  sdsl::int_vector<> samples_;  // position of the 1st, (kRate+1)-th, ... B bit
+
+  uint64_t _word(size_type w) const {
+    return B ? bv_->data()[w] : ~bv_->data()[w];
+  }
+
+ public:
+  SampledSelect() = default;
+  explicit SampledSelect(const sdsl::bit_vector* bv);
+
+  // Position of the i-th B bit, from 1
+  size_type select(size_type i) const;
+  size_type operator()(size_type i) const { return select(i); }
+
+  void set_vector(const sdsl::bit_vector* bv) { bv_ = bv; }
+  void swap(SampledSelect& rhs) { samples_.swap(rhs.samples_); }
+
+  size_type serialize(std::ostream& out, sdsl::structure_tree_node* v = nullptr,
+                      std::string name = "") const;
+  void load(std::istream& in, const sdsl::bit_vector* bv = nullptr);
+};
+
+// Rank/select supports of BasicLouds and BasicDfuds, and the BpSupport of
+// BasicDfuds. A policy may use any sdsl support on a plain bit_vector, e.g.
+// select_support_scan where select is rare. kImageId tells trie images
+// (image.hpp) which policy wrote their stored supports.
+
+// What Louds and Dfuds use.
+struct DefaultRankSelect {
+  static constexpr uint32_t kImageId = 0;
+  template<uint8_t B>
+  using rank_type = sdsl::rank_support_v<B, 1>;
+  template<uint8_t B>
+  using select_type = sdsl::select_support_mcl<B, 1>;
+  template<typename RankL>
+  using bp_type = BpSupport<0, sdsl::rrr_vector<>, RankL>;
+};
+
+// Select from a sample every 128 bits, and Elias-Fano pioneers, the fastest
+// findclose in bp_bench. rank_support_v stays: rank_support_il needs a
+// bit_vector_il, and is no faster on a copy of the bits.
+struct FastRankSelect {
+  static constexpr uint32_t kImageId = 1;
+  template<uint8_t B>
+  using rank_type = sdsl::rank_support_v<B, 1>;
+  template<uint8_t B>
+  using select_type = SampledSelect<B, 128>;
+  template<typename RankL>
+  using bp_type = BpSupport<0, sdsl::sd_vector<>, RankL>;
+};
+
+// 6.25% rank directories instead of 25%, select from a sample every 1024
+// bits, and larger RRR blocks for pioneers.
+struct SmallRankSelect {
+  static constexpr uint32_t kImageId = 2;
+  template<uint8_t B>
+  using rank_type = sdsl::rank_support_v5<B, 1>;
+  template<uint8_t B>
+  using select_type = SampledSelect<B, 1024>;
+  template<typename RankL>
+  using bp_type = BpSupport<0, sdsl::rrr_vector<63>, RankL>;
+};
+
+template<uint8_t B, uint32_t kRate>
+SampledSelect<B, kRate>::SampledSelect(const sdsl::bit_vector* bv) : bv_(bv) {
+  if (!bv_)
+    return;
+  auto n = bv_->size();
+  auto words = (n + 63) / 64;
+  size_type count = 0;
+  std::vector<size_type> samples;
+  for (size_type w = 0; w < words; w++) {
+    auto x = _word(w);
+    if (w + 1 == words and n % 64)
+      x &= (uint64_t(1) << (n % 64)) - 1;
+    auto c = sdsl::bits::cnt(x);
+    // The B bits of this word are count+1 .. count+c
+    auto next = samples.size() * kRate + 1;
+    if (next <= count + c)
+      samples.push_back(w * 64 + sdsl::bits::sel(x, next - count));
+    count += c;
+  }
+  samples_ = sdsl::int_vector<>(samples.size(), 0, sdsl::bits::hi(std::max<size_type>(n, 1)) + 1);
+  for (size_type i = 0; i < samples.size(); i++)
+    samples_[i] = samples[i];
+}
+
+template<uint8_t B, uint32_t kRate>
+typename SampledSelect<B, kRate>::size_type
+SampledSelect<B, kRate>::select(size_type i) const {
+  auto s = (i - 1) / kRate;
+  size_type pos = samples_[s];
+  size_type rest = i - s * kRate;
+  auto w = pos / 64;
+  auto x = _word(w) & (~uint64_t(0) << (pos % 64));
+  for (size_type c; (c = sdsl::bits::cnt(x)) < rest; x = _word(++w))
+    rest -= c;
+  return w * 64 + sdsl::bits::sel(x, rest);
+}
+
+template<uint8_t B, uint32_t kRate>
+typename SampledSelect<B, kRate>::size_type
+SampledSelect<B, kRate>::serialize(std::ostream& out, sdsl::structure_tree_node* v,
+                                   std::string name) const {
+  auto child = sdsl::structure_tree::add_child(v, name, sdsl::util::class_name(*this));
+  auto written = samples_.serialize(out, child, "samples");
+  sdsl::structure_tree::add_size(child, written);
+  return written;
+}
+
+template<uint8_t B, uint32_t kRate>
+void SampledSelect<B, kRate>::load(std::istream& in, const sdsl::bit_vector* bv) {
+  samples_.load(in);
+  set_vector(bv);
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__RANK_SELECT_HPP_
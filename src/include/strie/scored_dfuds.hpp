@@ -0,0 +1,123 @@
+#ifndef SUCCINCT_TRIES__SCORED_DFUDS_HPP_
+#define SUCCINCT_TRIES__SCORED_DFUDS_HPP_
+
+#include "dfuds.hpp"
+
+#include <string>
+#include <string_view>
+#include <iterator>
+#include <type_traits>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include <queue>
+#include <tuple>
+#include <utility>
+
+#include <sdsl/int_vector.hpp>
+#include <sdsl/rmq_support.hpp>
+#include <sdsl/util.hpp>
+
+namespace strie {
+
+// DfudsTrie with a score per key, answering top-k completion of a prefix.
+// Scores are stored in preorder (= sorted key order) with a range-maximum
+// structure over them, so that only k leaves of the prefix subtree are touched.
+class ScoredDfudsTrie : public DfudsTrie {
+  using trie = DfudsTrie;
+  using dfuds = Dfuds;
+ public:
+  using score_type = uint64_t;
+  using result_type = std::vector<std::pair<value_type, score_type>>;
+ private:
+  sdsl::int_vector<> scores_;
+  sdsl::rmq_succinct_sct<false> rmq_;
+
+  template<typename ScoreIt>
+  void _build_scores(ScoreIt score_begin);
+
+  // Key of the id-th leaf in the subtree of idx, appended to key
+  void _decode(index_type idx, index_type id, value_type& key) const;
+
+ public:
+  ScoredDfudsTrie() = default;
+  template<typename It, typename ScoreIt>
+  ScoredDfudsTrie(It begin, It end, ScoreIt score_begin) : ScoredDfudsTrie() {
+    trie::_build(begin, end);
+    _build_scores(score_begin);
+  }
+
+  score_type score(index_type id) const { return scores_[id]; }
+
+  // Best k keys starting with prefix, by descending score.
+  result_type top_k(std::string_view prefix, size_t k) const;
+
+};
+
+template<typename ScoreIt>
+void ScoredDfudsTrie::_build_scores(ScoreIt score_begin) {
+  using traits = std::iterator_traits<ScoreIt>;
+  static_assert(std::is_convertible_v<typename traits::value_type, score_type>);
+
+  scores_ = sdsl::int_vector<>(size(), 0, 64);
+  auto it = score_begin;
+  for (size_t i = 0; i < size(); i++, ++it)
+    scores_[i] = *it;
+  sdsl::util::bit_compress(scores_);
+  if (!empty())
+    rmq_ = decltype(rmq_)(&scores_);
+}
+
+inline void ScoredDfudsTrie::_decode(index_type idx, index_type id, value_type& key) const {
+  while (!(leaf_[dfuds::rankR(idx)] and trie::_leaf_rank(idx) == id)) {
+    // Last child whose first leaf is not after id
+    index_type lo = 0, hi = dfuds::degree(idx);
+    assert(hi > 0);
+    while (hi - lo > 1) {
+      auto mid = lo + (hi - lo) / 2;
+      if (trie::_leaf_rank(dfuds::child(idx, mid)) <= id)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    key.push_back(chars_[idx + lo]);
+    idx = dfuds::child(idx, lo);
+  }
+}
+
+inline ScoredDfudsTrie::result_type
+ScoredDfudsTrie::top_k(std::string_view prefix, size_t k) const {
+  result_type ret;
+  auto idx = trie::_traverse(prefix, prefix.length());
+  if (idx == INVALID or k == 0)
+    return ret;
+  index_type b = trie::_leaf_rank(idx);
+  index_type e = leaf_rank_(dfuds::rankR(trie::_subtree_end(idx)) + 1);
+  if (b == e)
+    return ret;
+
+  // (score, argmax, range) ordered by score
+  using entry_type = std::tuple<score_type, index_type, index_type, index_type>;
+  std::priority_queue<entry_type> qs;
+  auto push = [&](index_type l, index_type r) {
+    if (l == r)
+      return;
+    auto m = rmq_(l, r - 1);
+    qs.emplace(scores_[m], m, l, r);
+  };
+  push(b, e);
+  ret.reserve(std::min(k, e - b));
+  while (!qs.empty() and ret.size() < k) {
+    auto [s, m, l, r] = qs.top(); qs.pop();
+    value_type key(prefix);
+    _decode(idx, m, key);
+    ret.emplace_back(std::move(key), s);
+    push(l, m);
+    push(m + 1, r);
+  }
+  return ret;
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__SCORED_DFUDS_HPP_
@@ -0,0 +1,247 @@
+#ifndef SUCCINCT_TRIES__SHARDED_TRIE_HPP_
+#define SUCCINCT_TRIES__SHARDED_TRIE_HPP_
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <iterator>
+#include <type_traits>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "key.hpp"
+#include "numa.hpp"
+
+namespace strie {
+
+struct ShardOptions {
+  size_t num_shards = 0;  // 0: one per thread
+  unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+  // Build shards on threads pinned to NUMA nodes, so that each shard's pages
+  // lie on its node. Shards are spread over nodes in key order.
+  bool numa = false;
+};
+
+// Sorted keys split into independent tries T of consecutive keys, built in
+// parallel. Shards are cut near equal sizes, preferably where the first byte
+// of keys changes. A table on the first byte of a key gives the shards that
+// keys of that byte span; only if there are several a binary search over
+// their first keys picks one.
+// For T with ids in [0, size()), as CentroidPathTree's lookup and access,
+// the id of a key is its shard's offset plus its id in the shard. Shards hold
+// consecutive keys, so ids that are ranks in each shard are global ranks.
+template<typename T>
+class ShardedTrie {
+ public:
+  using trie_type = T;
+  using index_type = size_t;
+  using value_type = std::string;
+ private:
+  static constexpr size_t kCodes = 257; // empty key, then first bytes
+
+  std::vector<std::unique_ptr<T>> shards_;
+  std::vector<std::string> first_keys_;
+  std::vector<index_type> offsets_;  // keys before each shard, and the total
+  std::vector<int> nodes_;           // NUMA node id of each shard, or -1
+  std::array<uint32_t, kCodes> lo_, hi_;
+
+  static size_t _code(std::string_view key) {
+    return key.empty() ? 0 : (unsigned char) key[0] + 1;
+  }
+
+  // Shard ends near n/k, 2n/k, ..., moved within n/4k to a change of the
+  // first byte if there is one.
+  static std::vector<size_t> _cuts(const std::vector<std::string_view>& keys, size_t k);
+  void _route();
+
+ public:
+  ShardedTrie() : offsets_{0} {}
+  template<typename It>
+  ShardedTrie(It begin, It end, ShardOptions options = {});
+
+  size_t size() const { return offsets_.back(); }
+  bool empty() const { return size() == 0; }
+  size_t num_shards() const { return shards_.size(); }
+  const T& shard(size_t s) const { return *shards_[s]; }
+  // Keys before shard s
+  index_type offset(size_t s) const { return offsets_[s]; }
+  // OS id of the NUMA node shard s was built on, or -1
+  int numa_node(size_t s) const { return nodes_[s]; }
+
+  // Shard that holds key if any does, of a nonempty trie
+  size_t shard_of(std::string_view key) const;
+
+  bool contains(std::string_view key) const {
+    return !empty() and shards_[shard_of(key)]->contains(key);
+  }
+  bool contains(const std::string& key) const { return contains(std::string_view(key)); }
+  bool contains(const char* key) const { return contains(std::string_view(key)); }
+
+  // Global id of key, for T with lookup
+  std::optional<index_type> lookup(std::string_view key) const {
+    if (empty())
+      return std::nullopt;
+    auto s = shard_of(key);
+    auto id = shards_[s]->lookup(key);
+    if (!id)
+      return std::nullopt;
+    return offsets_[s] + *id;
+  }
+
+  // Key of global id, for T with access
+  value_type access(index_type id) const {
+    assert(id < size());
+    auto s = std::upper_bound(offsets_.begin(), offsets_.end(), id) - offsets_.begin() - 1;
+    return shards_[s]->access(id - offsets_[s]);
+  }
+
+  // Call f(key) for every key in sorted order, for T with for_each.
+  template<typename F>
+  void for_each(F&& f) const {
+    for (auto& t : shards_)
+      t->for_each(f);
+  }
+};
+
+template<typename T>
+template<typename It>
+ShardedTrie<T>::ShardedTrie(It begin, It end, ShardOptions options) : ShardedTrie() {
+  using traits = std::iterator_traits<It>;
+  static_assert(is_key_v<typename traits::value_type>);
+
+  std::vector<std::string_view> keys;
+  for (auto it = begin; it != end; ++it)
+    keys.push_back(key_view(*it));
+  for (size_t i = 1; i < keys.size(); i++)
+    if (not (keys[i-1] < keys[i]))
+      throw std::domain_error("Input string collection is not sorted.");
+
+  // The tries do not hold empty key sets; neither does any shard.
+  if (keys.empty())
+    return;
+  auto num_threads = std::max(1u, options.num_threads);
+  auto k = options.num_shards ? options.num_shards : num_threads;
+  k = std::min(k, keys.size());
+  auto cuts = _cuts(keys, k);
+  k = cuts.size() - 1;
+
+  shards_.resize(k);
+  nodes_.assign(k, -1);
+  offsets_.assign(cuts.begin(), cuts.end());
+  for (size_t s = 0; s < k; s++)
+    first_keys_.emplace_back(keys[cuts[s]]);
+  std::vector<numa::Node> nodes;
+  std::vector<size_t> node_of(k);
+  if (options.numa) {
+    nodes = numa::nodes();
+    for (size_t s = 0; s < k; s++) {
+      node_of[s] = s * nodes.size() / k;
+      nodes_[s] = nodes[node_of[s]].id;
+    }
+  }
+
+  // Threads take shards in order, each pinned to the node of its shard. The
+  // first failure, e.g. to pin, stops them and is rethrown.
+  std::atomic<size_t> next = 0;
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto work = [&] {
+    try {
+      for (size_t s; (s = next++) < k; ) {
+        if (options.numa)
+          numa::pin(nodes[node_of[s]].cpus);
+        shards_[s] = std::make_unique<T>(keys.begin() + cuts[s], keys.begin() + cuts[s+1]);
+      }
+    } catch (...) {
+      next = k;
+      std::lock_guard lock(error_mutex);
+      if (!error)
+        error = std::current_exception();
+    }
+  };
+  std::vector<std::thread> ths;
+  for (unsigned t = 1; t < std::min<size_t>(num_threads, k); t++)
+    ths.emplace_back(work);
+  if (options.numa) {
+    // Leave the calling thread's affinity as it was.
+    std::thread(work).join();
+  } else {
+    work();
+  }
+  for (auto& th : ths)
+    th.join();
+  if (error)
+    std::rethrow_exception(error);
+  _route();
+}
+
+template<typename T>
+std::vector<size_t> ShardedTrie<T>::_cuts(const std::vector<std::string_view>& keys, size_t k) {
+  size_t n = keys.size();
+  std::vector<size_t> cuts = {0};
+  auto w = n / (4 * k);
+  auto changes = [&](size_t i) { return 0 < i and i < n and _code(keys[i-1]) != _code(keys[i]); };
+  for (size_t s = 1; s < k; s++) {
+    auto c = s * n / k;
+    for (size_t d = 0; d <= w; d++) {
+      if (changes(c - std::min(c, d))) {
+        c -= d;
+        break;
+      }
+      if (changes(c + d)) {
+        c += d;
+        break;
+      }
+    }
+    if (c > cuts.back())
+      cuts.push_back(c);
+  }
+  cuts.push_back(n);
+  return cuts;
+}
+
+template<typename T>
+void ShardedTrie<T>::_route() {
+  // Codes of the first keys of each shard and of the next one
+  size_t k = shards_.size();
+  std::vector<size_t> first(k), last(k);
+  for (size_t s = 0; s < k; s++) {
+    first[s] = _code(first_keys_[s]);
+    last[s] = s + 1 < k ? _code(first_keys_[s+1]) : kCodes - 1;
+  }
+  for (size_t c = 0; c < kCodes; c++) {
+    size_t lo = 0, hi = k - 1;
+    while (lo < k - 1 and last[lo] < c)
+      lo++;
+    while (hi > 0 and first[hi] > c)
+      hi--;
+    lo_[c] = lo;
+    hi_[c] = std::max(lo, hi);
+  }
+}
+
+template<typename T>
+size_t ShardedTrie<T>::shard_of(std::string_view key) const {
+  auto c = _code(key);
+  size_t lo = lo_[c], hi = hi_[c];
+  if (lo == hi)
+    return lo;
+  // Last shard in [lo, hi] whose first key is at most key
+  auto it = std::upper_bound(first_keys_.begin() + lo + 1, first_keys_.begin() + hi + 1, key,
+                             [](std::string_view a, const std::string& b) { return a < b; });
+  return it - first_keys_.begin() - 1;
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__SHARDED_TRIE_HPP_
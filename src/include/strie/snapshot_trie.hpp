@@ -0,0 +1,147 @@
+#ifndef SUCCINCT_TRIES__SNAPSHOT_TRIE_HPP_
+#define SUCCINCT_TRIES__SNAPSHOT_TRIE_HPP_
+
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace strie {
+
+// Handle publishing immutable tries (Louds, DfudsTrie, CentroidPathTree, ...)
+// to concurrent readers through an atomic pointer.
+// Readers announce the global epoch in a slot of their own while they hold a
+// Snapshot, and never lock. A replaced trie is retired with the epoch of its
+// replacement, and deleted once every announced epoch has passed it.
+template<typename T>
+class SnapshotTrie {
+ public:
+  using trie_type = T;
+ private:
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> epoch{0}; // 0 while quiescent
+    std::atomic<bool> used{false};
+  };
+
+  std::atomic<const trie_type*> current_;
+  std::atomic<uint64_t> epoch_;
+  std::unique_ptr<Slot[]> slots_;
+  size_t num_slots_;
+  mutable std::mutex writer_mtx_;
+  std::vector<std::tuple<uint64_t, const trie_type*>> retired_;
+
+  Slot& _acquire_slot() const {
+    auto i = std::hash<std::thread::id>()(std::this_thread::get_id());
+    for (;; ++i) {
+      auto& slot = slots_[i % num_slots_];
+      if (!slot.used.load(std::memory_order_relaxed) and
+          !slot.used.exchange(true, std::memory_order_acquire))
+        return slot;
+      if (i % num_slots_ == num_slots_ - 1)
+        std::this_thread::yield();
+    }
+  }
+
+  // Requires writer_mtx_.
+  size_t _reclaim();
+
+ public:
+  class Snapshot {
+    Slot* slot_;
+    const trie_type* trie_;
+    friend class SnapshotTrie;
+    Snapshot(Slot& slot, const trie_type* trie) : slot_(&slot), trie_(trie) {}
+   public:
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+    Snapshot(Snapshot&& rhs) noexcept : slot_(rhs.slot_), trie_(rhs.trie_) { rhs.slot_ = nullptr; }
+    ~Snapshot() {
+      if (!slot_)
+        return;
+      slot_->epoch.store(0, std::memory_order_release);
+      slot_->used.store(false, std::memory_order_release);
+    }
+    const trie_type& operator*() const { return *trie_; }
+    const trie_type* operator->() const { return trie_; }
+    const trie_type* get() const { return trie_; }
+  };
+
+  explicit SnapshotTrie(std::unique_ptr<const trie_type> trie,
+                        size_t num_slots = 2 * std::max(1u, std::thread::hardware_concurrency()))
+      : current_(trie.release()), epoch_(1), slots_(new Slot[num_slots]), num_slots_(num_slots) {
+    assert(num_slots_ > 0);
+  }
+  SnapshotTrie(const SnapshotTrie&) = delete;
+  SnapshotTrie& operator=(const SnapshotTrie&) = delete;
+  ~SnapshotTrie() {
+    for (auto [e, t] : retired_)
+      delete t;
+    delete current_.load();
+  }
+
+  // Pin the current trie; it stays alive until the Snapshot is destroyed.
+  Snapshot snapshot() const {
+    auto& slot = _acquire_slot();
+    slot.epoch.store(epoch_.load());
+    return Snapshot(slot, current_.load());
+  }
+
+  template<typename STR>
+  bool contains(const STR& key) const {
+    return snapshot()->contains(key);
+  }
+
+  // Replace the current trie. The previous one is deleted once no reader
+  // can still hold it; returns the number of retired tries deleted.
+  size_t publish(std::unique_ptr<const trie_type> trie);
+
+  // Delete the retired tries no reader can still hold.
+  size_t reclaim() {
+    std::lock_guard lock(writer_mtx_);
+    return _reclaim();
+  }
+
+  size_t num_retired() const {
+    std::lock_guard lock(writer_mtx_);
+    return retired_.size();
+  }
+
+};
+
+template<typename T>
+size_t SnapshotTrie<T>::publish(std::unique_ptr<const trie_type> trie) {
+  std::lock_guard lock(writer_mtx_);
+  auto old = current_.exchange(trie.release());
+  // Readers announcing this epoch or later load the new trie.
+  auto e = epoch_.fetch_add(1) + 1;
+  retired_.emplace_back(e, old);
+  return _reclaim();
+}
+
+template<typename T>
+size_t SnapshotTrie<T>::_reclaim() {
+  uint64_t min_epoch = std::numeric_limits<uint64_t>::max();
+  for (size_t i = 0; i < num_slots_; i++) {
+    auto e = slots_[i].epoch.load();
+    if (e != 0)
+      min_epoch = std::min(min_epoch, e);
+  }
+  size_t cnt = 0;
+  auto it = retired_.begin();
+  for (; it != retired_.end() and std::get<0>(*it) <= min_epoch; ++it, ++cnt)
+    delete std::get<1>(*it);
+  retired_.erase(retired_.begin(), it);
+  return cnt;
+}
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__SNAPSHOT_TRIE_HPP_
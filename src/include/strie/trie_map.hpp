@@ -0,0 +1,100 @@
+#ifndef SUCCINCT_TRIES__TRIE_MAP_HPP_
+#define SUCCINCT_TRIES__TRIE_MAP_HPP_
+
+#include "louds.hpp"
+#include "dfuds.hpp"
+
+#include <string>
+#include <cstring>
+#include <string_view>
+#include <iterator>
+#include <type_traits>
+#include <optional>
+#include <vector>
+
+#include <sdsl/int_vector.hpp>
+#include <sdsl/util.hpp>
+
+namespace strie {
+
+// Louds mapping each key to an unsigned integer.
+// Values are bit-compressed and ordered by leaf rank (level order of keys).
+template<typename V>
+class LoudsMap : public Louds {
+  static_assert(std::is_unsigned_v<V>);
+  using trie = Louds;
+ public:
+  using mapped_type = V;
+ private:
+  sdsl::int_vector<> values_;
+
+ public:
+  LoudsMap() = default;
+  template<typename It, typename ValueIt>
+  LoudsMap(It begin, It end, ValueIt value_begin) : LoudsMap() {
+    using traits = std::iterator_traits<ValueIt>;
+    static_assert(std::is_convertible_v<typename traits::value_type, mapped_type>);
+    std::vector<mapped_type> vs;
+    auto vit = value_begin;
+    for (auto it = begin; it != end; ++it, ++vit)
+      vs.push_back(*vit);
+    values_ = sdsl::int_vector<>(vs.size(), 0, sizeof(mapped_type) * 8);
+    size_t i = 0;
+    trie::_build(begin, end, [&](size_t o) { values_[i++] = vs[o]; });
+    sdsl::util::bit_compress(values_);
+  }
+
+  template<typename STR>
+  std::optional<mapped_type> find(STR&& key, index_type len) const {
+    auto idx = trie::_traverse(key, len);
+    if (idx == INVALID or !leaf_[trie::_rank0(idx)])
+      return std::nullopt;
+    return values_[trie::_leaf_rank(idx)];
+  }
+  std::optional<mapped_type> find(const std::string& key) const { return find(key, key.length()); }
+  std::optional<mapped_type> find(std::string_view key) const { return find(key, key.length()); }
+  std::optional<mapped_type> find(const char* key) const { return find(key, std::strlen(key)); }
+
+};
+
+// DfudsTrie mapping each key to an unsigned integer.
+// Leaves are in preorder, so values keep the sorted order of the keys.
+template<typename V>
+class DfudsMap : public DfudsTrie {
+  static_assert(std::is_unsigned_v<V>);
+  using trie = DfudsTrie;
+ public:
+  using mapped_type = V;
+ private:
+  sdsl::int_vector<> values_;
+
+ public:
+  DfudsMap() = default;
+  template<typename It, typename ValueIt>
+  DfudsMap(It begin, It end, ValueIt value_begin) : DfudsMap() {
+    using traits = std::iterator_traits<ValueIt>;
+    static_assert(std::is_convertible_v<typename traits::value_type, mapped_type>);
+    trie::_build(begin, end);
+    values_ = sdsl::int_vector<>(size(), 0, sizeof(mapped_type) * 8);
+    auto vit = value_begin;
+    for (size_t i = 0; i < size(); i++, ++vit)
+      values_[i] = *vit;
+    sdsl::util::bit_compress(values_);
+  }
+
+  template<typename STR>
+  std::optional<mapped_type> find(STR&& key, index_type len) const {
+    auto idx = trie::_traverse(key, len);
+    if (idx == INVALID or !leaf_[Dfuds::rankR(idx)])
+      return std::nullopt;
+    return values_[trie::_leaf_rank(idx)];
+  }
+  std::optional<mapped_type> find(const std::string& key) const { return find(key, key.length()); }
+  std::optional<mapped_type> find(std::string_view key) const { return find(key, key.length()); }
+  std::optional<mapped_type> find(const char* key) const { return find(key, std::strlen(key)); }
+
+};
+
+} // namespace strie
+
+#endif //SUCCINCT_TRIES__TRIE_MAP_HPP_
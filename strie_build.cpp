@@ -0,0 +1,92 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+#include <strie/build_best.hpp>
+#include <strie/builder.hpp>
+#include <strie/image.hpp>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+
+// Builds a trie of the keys of a file, one per line in any order, and writes
+// its image (image.hpp). --store-supports stores rank/select and BpSupport
+// too, so that loading need not rebuild them. space and latency build the
+// structure build_best estimates smallest or fastest for the keys.
+//
+// usage: strie-build louds|dfuds|centroid|space|latency key_file|- image_file [--store-supports]
+
+namespace {
+
+template<typename T>
+int build(const std::string& type, const std::vector<std::string>& keys, const char* path,
+          strie::image::Supports supports) {
+  auto start = std::chrono::steady_clock::now();
+  auto trie = strie::build_unsorted<T>(keys.begin(), keys.end());
+  auto sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::ofstream ofs(path, std::ios::binary);
+  auto bytes = strie::image::save(trie, ofs, supports);
+  if (!ofs.flush()) {
+    std::cerr << "Cannot write " << path << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cerr << type << ": " << trie.size() << " keys, " << bytes << " bytes, "
+            << sec << " s" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+int build_best(const std::vector<std::string>& keys, const char* path, strie::Objective objective,
+               strie::image::Supports supports) {
+  auto start = std::chrono::steady_clock::now();
+  auto views = strie::sorted_unique_views(keys.begin(), keys.end());
+  auto trie = strie::build_best(views.begin(), views.end(), objective);
+  auto sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::ofstream ofs(path, std::ios::binary);
+  auto bytes = trie.save(ofs, supports);
+  if (!ofs.flush()) {
+    std::cerr << "Cannot write " << path << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cerr << trie.name() << ": " << trie.size() << " keys, " << bytes << " bytes, "
+            << sec << " s" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc < 4) {
+    std::cerr << "usage: strie-build louds|dfuds|centroid|space|latency key_file|- image_file [--store-supports]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::string type = argv[1], key_path = argv[2];
+  auto supports = argc > 4 and std::string(argv[4]) == "--store-supports"
+      ? strie::image::Supports::kStore : strie::image::Supports::kRebuild;
+  std::ifstream ifs;
+  if (key_path != "-") {
+    ifs.open(key_path);
+    if (!ifs) {
+      std::cerr << "Cannot open " << key_path << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  std::istream& in = key_path == "-" ? std::cin : ifs;
+  std::vector<std::string> keys;
+  for (std::string s; std::getline(in, s); )
+    keys.push_back(s);
+
+  if (type == "louds")
+    return build<strie::Louds>(type, keys, argv[3], supports);
+  if (type == "dfuds")
+    return build<strie::DfudsTrie>(type, keys, argv[3], supports);
+  if (type == "centroid")
+    return build<strie::CentroidPathTree>(type, keys, argv[3], supports);
+  if (type == "space" or type == "latency")
+    return build_best(keys, argv[3], type == "space" ? strie::Objective::kSpace : strie::Objective::kLatency,
+                      supports);
+  std::cerr << "Unknown type: " << type << std::endl;
+  return EXIT_FAILURE;
+}
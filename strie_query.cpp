@@ -0,0 +1,112 @@
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+#include <strie/centroid_path_tree.hpp>
+#include <strie/image.hpp>
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+// Maps an image written by strie-build, loads it and looks up the queries of a file,
+// one per line, on num_threads threads. Prints throughput to stderr, and with
+// --print each query with 1 or 0 in input order to stdout.
+//
+// usage: strie-query image_file [query_file|-] [num_threads] [--print]
+
+namespace {
+
+template<typename T>
+int query(strie::image::Reader& image, const std::vector<std::string>& queries, unsigned num_threads,
+          bool print) {
+  T trie;
+  auto start = std::chrono::steady_clock::now();
+  try {
+    strie::image::load(trie, image);
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  auto load_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::vector<uint8_t> found(queries.size());
+  auto chunk = (queries.size() + num_threads - 1) / num_threads;
+  start = std::chrono::steady_clock::now();
+  std::vector<std::thread> ths;
+  for (unsigned t = 0; t < num_threads; t++) {
+    ths.emplace_back([&, t] {
+      for (auto i = t * chunk; i < std::min(queries.size(), (t+1) * chunk); i++)
+        found[i] = trie.contains(queries[i]);
+    });
+  }
+  for (auto& th : ths)
+    th.join();
+  auto sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  size_t num_found = 0;
+  for (size_t i = 0; i < queries.size(); i++) {
+    num_found += found[i];
+    if (print)
+      std::cout << queries[i] << '\t' << int(found[i]) << '\n';
+  }
+  std::cerr << trie.size() << " keys loaded in " << load_sec << " s; "
+            << num_found << "/" << queries.size() << " found on " << num_threads << " threads, "
+            << queries.size() / sec / 1e6 << " Mqueries/s" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<std::string> args(argv + 1, argv + argc);
+  bool print = false;
+  for (auto it = args.begin(); it != args.end(); )
+    if (*it == "--print")
+      print = true, it = args.erase(it);
+    else
+      ++it;
+  if (args.empty()) {
+    std::cerr << "usage: strie-query image_file [query_file|-] [num_threads] [--print]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::optional<strie::image::MappedFile> file;
+  std::optional<strie::image::Reader> image;
+  try {
+    file.emplace(args[0]);
+    image.emplace(file->data(), file->size());
+  } catch (const std::exception& e) {
+    std::cerr << args[0] << ": " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::string query_path = args.size() > 1 ? args[1] : "-";
+  unsigned num_threads = args.size() > 2 ? std::stoul(args[2]) : std::thread::hardware_concurrency();
+  num_threads = std::max(1u, num_threads);
+
+  std::ifstream ifs;
+  if (query_path != "-") {
+    ifs.open(query_path);
+    if (!ifs) {
+      std::cerr << "Cannot open " << query_path << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  std::istream& in = query_path == "-" ? std::cin : ifs;
+  std::vector<std::string> queries;
+  for (std::string s; std::getline(in, s); )
+    queries.push_back(s);
+
+  switch (image->type()) {
+    case strie::image::Type::kLouds:
+      return query<strie::Louds>(*image, queries, num_threads, print);
+    case strie::image::Type::kDfuds:
+      return query<strie::DfudsTrie>(*image, queries, num_threads, print);
+    case strie::image::Type::kCentroidPathTree:
+      return query<strie::CentroidPathTree>(*image, queries, num_threads, print);
+  }
+  std::cerr << "Unknown image type " << uint32_t(image->type()) << std::endl;
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,75 @@
+#include <strie/bp.hpp>
+#include <strie/louds.hpp>
+#include <strie/dfuds.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <random>
+#include <set>
+
+// Const queries on one shared instance must give the single-threaded answers.
+template<typename F>
+void run_concurrently(F f) {
+  std::vector<std::thread> ths;
+  auto nt = std::max(4u, std::thread::hardware_concurrency());
+  for (unsigned t = 0; t < nt; t++)
+    ths.emplace_back(f, t);
+  for (auto& th : ths)
+    th.join();
+}
+
+int main() {
+  std::mt19937 rng(0);
+  std::set<std::string> st;
+  while (st.size() < 20000) {
+    std::string s(1 + rng() % 10, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    st.insert(s);
+  }
+  std::vector<std::string> keys(st.begin(), st.end()), queries;
+  for (int i = 0; i < 20000; i++) {
+    std::string s(1 + rng() % 10, 'a');
+    for (auto& c : s) c = 'a' + rng() % 5;
+    queries.push_back(s);
+  }
+
+  strie::Louds louds(keys.begin(), keys.end());
+  strie::DfudsTrie dfuds(keys.begin(), keys.end());
+  std::vector<bool> expected(queries.size());
+  for (size_t i = 0; i < queries.size(); i++)
+    expected[i] = st.count(queries[i]);
+
+  std::string bp = "1";
+  for (int i = 0; i < 100000; i++)
+    bp += rng() % 2 ? "10" : "1";
+  bp += std::string(std::count(bp.begin(), bp.end(), '1') * 2 - bp.size(), '0');
+  sdsl::bit_vector bv(bp.size());
+  for (size_t i = 0; i < bp.size(); i++)
+    bv[i] = bp[i] == '1';
+  sdsl::rank_support_v<> rank(&bv);
+  strie::BpSupport<> bps(&bv, &rank);
+  std::vector<size_t> fc(bp.size());
+  for (size_t i = 0; i < bp.size(); i++) if (bv[i])
+    fc[i] = bps.findclose(i);
+
+  std::atomic<bool> failed = false;
+  run_concurrently([&](unsigned t) {
+    for (int r = 0; r < 5; r++) {
+      for (size_t i = t; i < queries.size() + t; i++) {
+        auto j = i % queries.size();
+        if (louds.contains(queries[j]) != expected[j] or dfuds.contains(queries[j]) != expected[j])
+          failed = true;
+      }
+      for (size_t i = 0; i < bp.size(); i++)
+        if (bv[i] and bps.findclose(i) != fc[i])
+          failed = true;
+    }
+  });
+  if (failed) {
+    std::cerr << "Concurrent queries differ" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::cout << "OK" << std::endl;
+}
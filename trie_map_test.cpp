@@ -0,0 +1,43 @@
+#include <strie/trie_map.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <set>
+#include <algorithm>
+
+template<typename M>
+void test_map(const std::vector<std::string>& keys, const std::vector<uint32_t>& values) {
+  M map(keys.begin(), keys.end(), values.begin());
+  for (size_t i = 0; i < keys.size(); i++) {
+    auto v = map.find(keys[i]);
+    if (!v or *v != values[i]) {
+      std::cerr << keys[i] << " is not mapped to " << values[i] << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (auto key : {"e", "aaaaaaaaaaaaaaaaaaaa", "abcde"}) {
+    if (map.find(key) and !std::binary_search(keys.begin(), keys.end(), key)) {
+      std::cerr << key << " is mapped!" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+int main() {
+  std::mt19937 rng(0);
+  std::set<std::string> st;
+  while (st.size() < 20000) {
+    std::string s(rng() % 10, 'a');
+    for (auto& c : s) c = 'a' + rng() % 4;
+    st.insert(s);
+  }
+  std::vector<std::string> keys(st.begin(), st.end());
+  std::vector<uint32_t> values(keys.size());
+  for (auto& v : values) v = rng() % (1u<<20);
+
+  test_map<strie::LoudsMap<uint32_t>>(keys, values);
+  test_map<strie::DfudsMap<uint32_t>>(keys, values);
+  std::cout << "OK" << std::endl;
+}